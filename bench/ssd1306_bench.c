@@ -0,0 +1,1092 @@
+/*
+*   ssd1306_bench.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*
+*   Host benchmark of the drawing primitives and flush paths, run against the simulated display.
+*   Usage: ssd1306_bench [--quick]
+*   Prints one JSON document: ns/op and pixels/s per primitive and size, bus bytes and transactions per flush,
+*   and the console, grayscale, dither and video throughput.
+*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_console.h"
+#include "ssd1306_gray.h"
+#include "ssd1306_dither.h"
+#include "ssd1306_video.h"
+#include "ssd1306_bus.h"
+#include "ssd1306_canvas.h"
+#include "ssd1306_worker.h"
+#include "ssd1306_text.h"
+#include "ssd1306_scale.h"
+
+#ifndef SSD1306_BENCH_VERSION
+#define SSD1306_BENCH_VERSION "dev"
+#endif
+
+static uint32_t iterations = 20000;
+static bool first_entry = true;
+
+static uint64_t bench_now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void bench_entry_begin(const char* section){
+    printf("%s\n    {\"section\": \"%s\"", first_entry ? "" : ",", section);
+    first_entry = false;
+}
+
+static void bench_entry_end(void){
+    printf("}");
+}
+
+// Primitives.
+
+typedef bool (*bench_draw_t)(uint32_t i, int16_t size);
+
+static bool bench_pixel(uint32_t i, int16_t size){
+    (void)size;
+    return ssd1306_DrawPixel((uint8_t)(i & 127), (uint8_t)((i >> 7) & 63), (i >> 13) & 1);
+}
+
+static bool bench_line(uint32_t i, int16_t size){
+    int16_t x = (int16_t)(i % (uint32_t)(128 - size + 1));
+    return ssd1306_DrawLine(x, 0, (int16_t)(x + size - 1), (int16_t)(size > 64 ? 63 : size - 1), 1, i & 1);
+}
+
+static bool bench_fill_rect(uint32_t i, int16_t size){
+    int16_t x = (int16_t)(i % (uint32_t)(128 - size + 1));
+    int16_t h = size > 64 ? 64 : size;
+    return ssd1306_FillRect(x, (int16_t)(i % (uint32_t)(64 - h + 1)), size, h, i & 1);
+}
+
+static bool bench_circle(uint32_t i, int16_t size){
+    return ssd1306_DrawCircle(64, 32, (uint16_t)(size / 2), 1, i & 1);
+}
+
+static bool bench_fill_circle(uint32_t i, int16_t size){
+    return ssd1306_FillCircle(64, 32, (uint16_t)(size / 2), i & 1);
+}
+
+static bool bench_fill_poly(uint32_t i, int16_t size){
+    int16_t r = (int16_t)(size / 2);
+    int16_t x[5] = { 64, (int16_t)(64 + r), (int16_t)(64 + r / 2), (int16_t)(64 - r / 2), (int16_t)(64 - r) };
+    int16_t y[5] = { (int16_t)(32 - r / 2), 32, (int16_t)(32 + r / 2), (int16_t)(32 + r / 2), 32 };
+    return ssd1306_FillPoly(x, y, 5, i & 1);
+}
+
+static bool bench_fill_rect_pattern(uint32_t i, int16_t size){
+    int16_t x = (int16_t)(i % (uint32_t)(128 - size + 1));
+    int16_t h = size > 64 ? 64 : size;
+    return ssd1306_FillRectPattern(x, (int16_t)(i % (uint32_t)(64 - h + 1)), size, h, &ssd1306_pattern_gray50);
+}
+
+// A 50% fill the way it is done without pattern support, one ssd1306_DrawPixel() per pixel.
+static bool bench_pattern_pixels(uint32_t i, int16_t size){
+    int16_t x = (int16_t)(i % (uint32_t)(128 - size + 1));
+    int16_t h = size > 64 ? 64 : size;
+    int16_t y = (int16_t)(i % (uint32_t)(64 - h + 1));
+    for (int16_t j = y; j < y + h; j++) {
+        for (int16_t k = x; k < x + size; k++)
+            ssd1306_DrawPixel((uint8_t)k, (uint8_t)j, ((k ^ j) & 1) == 0);
+    }
+    return true;
+}
+
+static bool bench_fill_circle_pattern(uint32_t i, int16_t size){
+    (void)i;
+    return ssd1306_FillCirclePattern(64, 32, (uint16_t)(size / 2), &ssd1306_pattern_hatch);
+}
+
+static bool bench_fill_poly_pattern(uint32_t i, int16_t size){
+    int16_t r = (int16_t)(size / 2);
+    int16_t x[5] = { 64, (int16_t)(64 + r), (int16_t)(64 + r / 2), (int16_t)(64 - r / 2), (int16_t)(64 - r) };
+    int16_t y[5] = { (int16_t)(32 - r / 2), 32, (int16_t)(32 + r / 2), (int16_t)(32 + r / 2), 32 };
+    return ssd1306_FillPolyPattern(x, y, 5, (i & 1) ? &ssd1306_pattern_gray25 : &ssd1306_pattern_gray75);
+}
+
+static bool bench_dashed_line(uint32_t i, int16_t size){
+    int16_t x = (int16_t)(i % (uint32_t)(128 - size + 1));
+    return ssd1306_DrawLineStyle(x, 0, (int16_t)(x + size - 1), (int16_t)(size > 64 ? 63 : size - 1), 1, i & 1, SSD1306_LINE_DASHED);
+}
+
+static bool bench_draw_arc(uint32_t i, int16_t size){
+    int16_t start = (int16_t)(i % 360);
+    return ssd1306_DrawArc(64, 32, (uint16_t)(size / 2), start, (int16_t)(start + 240), 1, i & 1);
+}
+
+static bool bench_fill_pie(uint32_t i, int16_t size){
+    int16_t start = (int16_t)(i % 360);
+    return ssd1306_FillPie(64, 32, (uint16_t)(size / 2), start, (int16_t)(start + 120), i & 1);
+}
+
+static bool bench_fill_rect_rotated(uint32_t i, int16_t size){
+    return ssd1306_FillRectRotated(64, 32, size, (int16_t)(size / 2), (int16_t)(i % 360), i & 1);
+}
+
+static uint8_t bench_bitmap[128 * 64 / 8];
+
+static bool bench_draw_bitmap(uint32_t i, int16_t size){
+    int16_t h = size > 64 ? 64 : size;
+    return ssd1306_DrawBitmap((int16_t)(i % (uint32_t)(128 - size + 1)), 0, bench_bitmap, size, h, i & 1);
+}
+
+static bool bench_write_string(uint32_t i, int16_t size){
+    static const char text[] = "The quick brown fox jumps over the lazy dog";
+    uint8_t len = (uint8_t)(size / (Font_5x8.width + 1));
+    if (len > sizeof(text) - 1) len = sizeof(text) - 1;
+    return ssd1306_WriteString(0, (int16_t)((i & 7) * 8), text, len, Font_5x8, true);
+}
+
+static void bench_primitive(const char* name, bench_draw_t draw, const int16_t* sizes, uint8_t size_count){
+    for (uint8_t s = 0; s < size_count; s++) {
+        ssd1306_Clear();
+        ssd1306_ResetDrawStats();
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < iterations; i++) {
+            draw(i, sizes[s]);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        ssd1306_draw_stats_t stats;
+        ssd1306_GetDrawStats(&stats);
+        double ns_per_op = (double)elapsed / iterations;
+        // Column writes touch up to 8 pixels, count them as 8 so byte wide paths are comparable.
+        double pixels = (double)stats.pixel_writes + 8.0 * stats.column_writes;
+
+        bench_entry_begin("primitive");
+        printf(", \"name\": \"%s\", \"size\": %d, \"ns_per_op\": %.1f, \"pixels_per_op\": %.1f, "
+               "\"pixel_writes_per_op\": %.1f, \"column_writes_per_op\": %.1f, \"pixels_per_s\": %.0f",
+               name, sizes[s], ns_per_op, pixels / iterations,
+               (double)stats.pixel_writes / iterations, (double)stats.column_writes / iterations,
+               elapsed ? pixels * 1e9 / (double)elapsed : 0.0);
+        bench_entry_end();
+    }
+}
+
+// Flood fill of the inside of a circle outline, against ssd1306_FillCircle() of the same circle. A filled region
+// joins its outline, so the outline is redrawn for every fill and only the fill is timed.
+
+static void bench_flood(const int16_t* sizes, uint8_t size_count){
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t s = 0; s < size_count; s++) {
+        uint16_t r = (uint16_t)(sizes[s] / 2);
+        uint64_t elapsed = 0;
+        ssd1306_area_t bounds = { 0 };
+        ssd1306_ResetDrawStats();
+        for (uint32_t i = 0; i < count; i++) {
+            ssd1306_Clear();
+            ssd1306_DrawCircle(64, 32, r, 1, true);
+            ssd1306_draw_stats_t before;
+            ssd1306_GetDrawStats(&before);
+            uint64_t start = bench_now_ns();
+            ssd1306_FloodFill(64, 32, true, NULL, 0, &bounds);
+            elapsed += bench_now_ns() - start;
+            ssd1306_draw_stats_t after;
+            ssd1306_GetDrawStats(&after);
+            if (i == 0) {
+                bench_entry_begin("flood");
+                printf(", \"size\": %d, \"column_writes_per_op\": %lu, \"bounds_w\": %d, \"bounds_h\": %d",
+                       sizes[s], (unsigned long)(after.column_writes - before.column_writes), bounds.w, bounds.h);
+            }
+        }
+        printf(", \"ns_per_op\": %.1f", (double)elapsed / count);
+        bench_entry_end();
+    }
+}
+
+// A redraw of a dial gauge: 240 degree arc, 9 ticks and the needle. Fixed point uses the Q14 table, the float
+// reference computes the same points with sinf() and cosf() and draws the arc as 5 degree chords.
+
+static void bench_gauge_fixed(int16_t value){
+    ssd1306_DrawArc(64, 40, 30, -30, 210, 1, true);
+    for (int16_t a = -30; a <= 210; a += 30)
+        ssd1306_DrawNeedle(64, 40, 24, 28, a, 1, true);
+    ssd1306_DrawNeedle(64, 40, 0, 26, value, 1, true);
+}
+
+static void bench_gauge_float(int16_t value){
+    const float rad = 3.14159265f / 180.0f;
+    for (int16_t a = -30; a < 210; a += 5) {
+        float a0 = a * rad, a1 = (a + 5) * rad;
+        ssd1306_DrawLine((int16_t)lroundf(64 + 30 * cosf(a0)), (int16_t)lroundf(40 - 30 * sinf(a0)),
+                         (int16_t)lroundf(64 + 30 * cosf(a1)), (int16_t)lroundf(40 - 30 * sinf(a1)), 1, true);
+    }
+    for (int16_t a = -30; a <= 210; a += 30) {
+        float c = cosf(a * rad), s = sinf(a * rad);
+        ssd1306_DrawLine((int16_t)lroundf(64 + 24 * c), (int16_t)lroundf(40 - 24 * s),
+                         (int16_t)lroundf(64 + 28 * c), (int16_t)lroundf(40 - 28 * s), 1, true);
+    }
+    ssd1306_DrawLine(64, 40, (int16_t)lroundf(64 + 26 * cosf(value * rad)), (int16_t)lroundf(40 - 26 * sinf(value * rad)), 1, true);
+}
+
+static void bench_gauge(void){
+    static const struct { const char* name; void (*draw)(int16_t value); } paths[] = {
+        { "fixed_q14", bench_gauge_fixed }, { "float", bench_gauge_float },
+    };
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+        uint64_t elapsed = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            ssd1306_Clear();
+            uint64_t start = bench_now_ns();
+            paths[p].draw((int16_t)(210 - i % 241));
+            elapsed += bench_now_ns() - start;
+        }
+        bench_entry_begin("gauge");
+        printf(", \"path\": \"%s\", \"ns_per_op\": %.1f", paths[p].name, (double)elapsed / count);
+        bench_entry_end();
+    }
+    // Largest difference of the table from the float sine over whole degrees, in Q14 steps.
+    int32_t error = 0;
+    for (int16_t a = -360; a <= 360; a++) {
+        int32_t d = ssd1306_Sin(a) - (int32_t)lroundf(sinf(a * 3.14159265f / 180.0f) * 16384.0f);
+        if (d < 0) d = -d;
+        if (d > error) error = d;
+    }
+    bench_entry_begin("gauge");
+    printf(", \"path\": \"sin_table\", \"max_error_q14\": %ld", (long)error);
+    bench_entry_end();
+}
+
+// Flush paths.
+
+static void bench_flush_entry(const char* name, uint32_t flushes, uint64_t elapsed_ns){
+    ssd1306_host_stats_t stats;
+    ssd1306_host_get_stats(&stats);
+    bench_entry_begin("flush");
+    printf(", \"name\": \"%s\", \"ns_per_flush\": %.1f, \"bytes_per_flush\": %.1f, "
+           "\"command_bytes_per_flush\": %.1f, \"data_bytes_per_flush\": %.1f, \"transactions_per_flush\": %.1f",
+           name, (double)elapsed_ns / flushes,
+           (double)(stats.command_bytes + stats.data_bytes) / flushes,
+           (double)stats.command_bytes / flushes, (double)stats.data_bytes / flushes,
+           (double)stats.transactions / flushes);
+    bench_entry_end();
+}
+
+static void bench_flush(void){
+    uint32_t flushes = iterations / 10 + 1;
+
+    ssd1306_host_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < flushes; i++) {
+        ssd1306_DrawPixel((uint8_t)(i & 127), 10, true);
+        ssd1306_UpdateScreen();
+    }
+    bench_flush_entry("update_screen", flushes, bench_now_ns() - start);
+
+    struct { const char* name; int16_t w, h; } cases[] = {
+        { "update_dirty_clean", 0, 0 },
+        { "update_dirty_8x8", 8, 8 },
+        { "update_dirty_text_line", 126, 8 },
+        { "update_dirty_32x32", 32, 32 },
+        { "update_dirty_full", 128, 64 },
+    };
+    for (uint8_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        ssd1306_UpdateDirty();
+        ssd1306_host_reset_stats();
+        start = bench_now_ns();
+        for (uint32_t i = 0; i < flushes; i++) {
+            if (cases[c].w) ssd1306_FillRect(0, 0, cases[c].w, cases[c].h, i & 1);
+            ssd1306_UpdateDirty();
+        }
+        bench_flush_entry(cases[c].name, flushes, bench_now_ns() - start);
+    }
+}
+
+// Wire time per flush for each backend, from the transactions of a single recorded flush.
+
+typedef bool (*bench_flush_t)(void);
+
+static bool bench_bus_update_screen(void){
+    ssd1306_DrawPixel(5, 5, true);
+    return ssd1306_UpdateScreen();
+}
+
+static bool bench_bus_text_line(void){
+    ssd1306_WriteString(0, 8, "Temperature 21.5 C", 18, Font_5x8, true);
+    return ssd1306_UpdateDirty();
+}
+
+static bool bench_bus_8x8(void){
+    ssd1306_FillRect(60, 28, 8, 8, true);
+    return ssd1306_UpdateDirty();
+}
+
+static bool bench_bus_console_line(void){
+    return ssd1306_Console_PrintLine("scrolled line");
+}
+
+static bool bench_bus_send_frame(void){
+    static uint8_t frame[128 * 64 / 8];
+    return ssd1306_SendFrame(frame);
+}
+
+static void bench_bus(void){
+    static const struct { const char* name; bench_flush_t flush; } flushes[] = {
+        { "update_screen", bench_bus_update_screen },
+        { "update_dirty_text_line", bench_bus_text_line },
+        { "update_dirty_8x8", bench_bus_8x8 },
+        { "console_line", bench_bus_console_line },
+        { "send_frame", bench_bus_send_frame },
+    };
+    static const ssd1306_bus_backend_t* backends[] = {
+        &ssd1306_bus_stm32_hal, &ssd1306_bus_esp_arduino, &ssd1306_bus_esp_idf, &ssd1306_bus_single,
+    };
+    static const uint32_t bus_hz[] = { 100000, 400000, 1000000 };
+
+    for (uint8_t f = 0; f < sizeof(flushes) / sizeof(flushes[0]); f++) {
+        ssd1306_ResetScroll();
+        ssd1306_Clear();
+        if (flushes[f].flush == bench_bus_console_line) {
+            // Fill the console so the measured line scrolls.
+            ssd1306_Console_Init(true);
+            for (uint8_t i = 0; i <= SSD1306_CONSOLE_ROWS; i++) ssd1306_Console_PrintLine("line");
+        }
+        ssd1306_UpdateScreen();
+        ssd1306_host_reset_stats();
+        flushes[f].flush();
+        for (uint8_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+            ssd1306_bus_cost_t cost = { 0 };
+            ssd1306_Bus_AddLog(backends[b], &cost);
+            for (uint8_t h = 0; h < sizeof(bus_hz) / sizeof(bus_hz[0]); h++) {
+                bench_entry_begin("bus");
+                printf(", \"flush\": \"%s\", \"backend\": \"%s\", \"bus_hz\": %lu, \"frames\": %lu, \"wire_bytes\": %lu, "
+                       "\"bits\": %lu, \"wire_us\": %lu, \"max_fps\": %lu",
+                       flushes[f].name, backends[b]->name, (unsigned long)bus_hz[h], (unsigned long)cost.frames,
+                       (unsigned long)cost.bytes, (unsigned long)cost.bits,
+                       (unsigned long)ssd1306_Bus_TimeUs(&cost, bus_hz[h]), (unsigned long)ssd1306_Bus_MaxFps(&cost, bus_hz[h]));
+                bench_entry_end();
+            }
+        }
+    }
+    ssd1306_ResetScroll();
+}
+
+// Console, scrolled through the start line versus a full redraw per line.
+
+static void bench_console(void){
+    uint32_t lines = iterations / 20 + 1;
+    char text[SSD1306_CONSOLE_COLUMNS + 1];
+
+    ssd1306_Console_Init(true);
+    ssd1306_UpdateScreen();
+    ssd1306_host_reset_stats();
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < lines; i++) {
+        snprintf(text, sizeof(text), "line %lu", (unsigned long)i);
+        ssd1306_Console_PrintLine(text);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+    ssd1306_host_stats_t ring;
+    ssd1306_host_get_stats(&ring);
+
+    ssd1306_ResetScroll();
+    ssd1306_host_reset_stats();
+    start = bench_now_ns();
+    for (uint32_t i = 0; i < lines; i++) {
+        snprintf(text, sizeof(text), "line %lu", (unsigned long)i);
+        ssd1306_Clear();
+        for (uint8_t row = 0; row < SSD1306_CONSOLE_ROWS; row++) {
+            ssd1306_WriteString(0, (int16_t)(row * 8), text, (uint8_t)strlen(text), Font_5x8, true);
+        }
+        ssd1306_UpdateScreen();
+    }
+    uint64_t naive_elapsed = bench_now_ns() - start;
+    ssd1306_host_stats_t naive;
+    ssd1306_host_get_stats(&naive);
+
+    bench_entry_begin("console");
+    printf(", \"lines_per_s\": %.0f, \"bytes_per_line\": %.1f, \"naive_lines_per_s\": %.0f, \"naive_bytes_per_line\": %.1f",
+           elapsed ? lines * 1e9 / (double)elapsed : 0.0,
+           (double)(ring.command_bytes + ring.data_bytes) / lines,
+           naive_elapsed ? lines * 1e9 / (double)naive_elapsed : 0.0,
+           (double)(naive.command_bytes + naive.data_bytes) / lines);
+    bench_entry_end();
+    ssd1306_ResetScroll();
+}
+
+// Grayscale plane cycling, one simulated second per bus speed.
+
+static void bench_gray(void){
+    static const uint32_t bus_hz[] = { 400000, 1000000 };
+    // Simulated time only moves forward so a transfer started by one run completes before the next.
+    uint32_t t = 0;
+    for (uint8_t b = 0; b < sizeof(bus_hz) / sizeof(bus_hz[0]); b++) {
+        for (uint8_t bits = 2; bits <= SSD1306_GRAY_MAX_BITS; bits++) {
+            ssd1306_host_set_dma_bus_hz(bus_hz[b]);
+            ssd1306_Gray_Init(bits, 400);
+            ssd1306_Gray_FillRect(0, 0, 64, 64, (uint8_t)((1u << bits) - 2));
+            // The rates are measured over 1 s windows, the second window is past start up.
+            uint32_t end = t + 2000000;
+            for (; t <= end; t += 50) {
+                ssd1306_host_set_time_us(t);
+                ssd1306_Gray_Tick(t);
+            }
+            ssd1306_gray_stats_t stats;
+            ssd1306_Gray_GetStats(&stats);
+            bench_entry_begin("gray");
+            printf(", \"bus_hz\": %lu, \"bits\": %u, \"plane_rate_hz\": %lu, \"cycle_rate_hz\": %lu, "
+                   "\"flicker_margin_pct\": %ld, \"planes_sent\": %lu, \"planes_skipped\": %lu, \"slots_late\": %lu",
+                   (unsigned long)bus_hz[b], bits, (unsigned long)stats.plane_rate_hz, (unsigned long)stats.cycle_rate_hz,
+                   (long)stats.flicker_margin_pct, (unsigned long)stats.planes_sent,
+                   (unsigned long)stats.planes_skipped, (unsigned long)stats.slots_late);
+            bench_entry_end();
+        }
+    }
+    // Let the last transfer complete, later sections flush synchronously.
+    ssd1306_host_set_time_us(t + 1000000);
+    ssd1306_platform_is_dma_done();
+    ssd1306_host_set_dma_bus_hz(0);
+}
+
+// Dithering of a full screen gradient.
+
+static void bench_dither(void){
+    static uint8_t gray[128 * 64];
+    static uint8_t bitmap[128 * 64 / 8];
+    static const struct { ssd1306_dither_mode_t mode; const char* name; } modes[] = {
+        { SSD1306_DITHER_THRESHOLD, "threshold" },
+        { SSD1306_DITHER_BAYER, "bayer" },
+        { SSD1306_DITHER_FLOYD_STEINBERG, "floyd_steinberg" },
+        { SSD1306_DITHER_ATKINSON, "atkinson" },
+    };
+#if defined(__SSE2__)
+    const char* simd = "sse2";
+#elif defined(__ARM_NEON)
+    const char* simd = "neon";
+#else
+    const char* simd = "none";
+#endif
+    for (uint16_t i = 0; i < sizeof(gray); i++) {
+        gray[i] = (uint8_t)((i & 127) * 2 + (i >> 7));
+    }
+    uint32_t frames = iterations / 100 + 1;
+    for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < frames; i++) {
+            ssd1306_Dither(gray, 128, 64, 128, modes[m].mode, 128, bitmap);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_entry_begin("dither");
+        printf(", \"mode\": \"%s\", \"simd\": \"%s\", \"us_per_frame\": %.2f, \"fps\": %.0f",
+               modes[m].name, simd, (double)elapsed / frames / 1000.0, elapsed ? frames * 1e9 / (double)elapsed : 0.0);
+        bench_entry_end();
+    }
+}
+
+// Video decode of a generated clip, a ball crossing the screen with a keyframe every 16 frames.
+
+static void bench_video(void){
+    enum { FRAMES = 64, KEY_INTERVAL = 16 };
+    static uint8_t stream[SSD1306_VIDEO_HEADER_SIZE + FRAMES * (3 + SSD1306_VIDEO_FRAME_SIZE)];
+    static uint8_t prev[SSD1306_VIDEO_FRAME_SIZE];
+    static uint8_t cur[SSD1306_VIDEO_FRAME_SIZE];
+    static uint8_t delta[SSD1306_VIDEO_FRAME_SIZE];
+
+    memcpy(stream, "S1VD", 4);
+    stream[4] = SSD1306_VIDEO_VERSION;
+    stream[5] = 128;
+    stream[6] = 64;
+    stream[7] = 30;
+    stream[8] = FRAMES;
+    uint32_t size = SSD1306_VIDEO_HEADER_SIZE;
+    for (uint16_t f = 0; f < FRAMES; f++) {
+        memset(cur, 0, sizeof(cur));
+        int16_t cx = (int16_t)(f * 2), cy = (int16_t)(32 + ((f & 15) < 8 ? (f & 7) * 3 : (8 - (f & 7)) * 3) - 12);
+        for (int16_t y = -8; y <= 8; y++) {
+            for (int16_t x = -8; x <= 8; x++) {
+                int16_t px = (int16_t)(cx + x), py = (int16_t)(cy + y);
+                if (x * x + y * y <= 64 && px >= 0 && px < 128 && py >= 0 && py < 64) {
+                    cur[(py >> 3) * 128 + px] |= (uint8_t)(1u << (py & 7));
+                }
+            }
+        }
+        uint16_t len = SSD1306_VIDEO_FRAME_SIZE;
+        if (f % KEY_INTERVAL != 0) {
+            len = ssd1306_Video_EncodeDelta(prev, cur, delta);
+        }
+        bool key = len >= SSD1306_VIDEO_FRAME_SIZE;
+        stream[size++] = key ? SSD1306_VIDEO_KEYFRAME : SSD1306_VIDEO_DELTA;
+        if (key) len = SSD1306_VIDEO_FRAME_SIZE;
+        stream[size++] = (uint8_t)(len & 0xFF);
+        stream[size++] = (uint8_t)(len >> 8);
+        memcpy(&stream[size], key ? cur : delta, len);
+        size += len;
+        memcpy(prev, cur, sizeof(prev));
+    }
+
+    ssd1306_video_t video;
+    if (!ssd1306_Video_OpenMemory(&video, stream, size, true)) {
+        return;
+    }
+    ssd1306_UpdateScreen();
+    uint32_t frames = iterations / 20 + FRAMES;
+    uint64_t decode_ns = 0;
+    uint32_t decode_bytes = 0;
+    ssd1306_host_reset_stats();
+    for (uint32_t i = 0; i < frames; i++) {
+        uint64_t start = bench_now_ns();
+        ssd1306_Video_DecodeNext(&video);
+        decode_ns += bench_now_ns() - start;
+        decode_bytes += video.stats.last_decode_bytes;
+        ssd1306_UpdateDirty();
+    }
+    ssd1306_host_stats_t stats;
+    ssd1306_host_get_stats(&stats);
+    ssd1306_Video_Close(&video);
+
+    bench_entry_begin("video");
+    printf(", \"frames\": %lu, \"stream_bytes\": %lu, \"decode_us_per_frame\": %.2f, \"decoded_bytes_per_frame\": %.1f, "
+           "\"bus_bytes_per_frame\": %.1f, \"transactions_per_frame\": %.1f",
+           (unsigned long)frames, (unsigned long)size, (double)decode_ns / frames / 1000.0, (double)decode_bytes / frames,
+           (double)(stats.command_bytes + stats.data_bytes) / frames, (double)stats.transactions / frames);
+    bench_entry_end();
+}
+
+// Multi panel canvases, simulated time from the flush until every panel has its frame, panels on one bus or one bus each.
+
+static void bench_canvas(void){
+    static const struct { const char* name; uint8_t tiles_x; uint8_t tiles_y; } layouts[] = {
+        { "256x64", 2, 1 }, { "128x128", 1, 2 }, { "256x128", 2, 2 },
+    };
+    static const uint32_t bus_hz[] = { 400000, 1000000 };
+    static uint8_t buffer[4 * 1024];
+    static const uint8_t panels[] = { 0, 1, 2, 3 };
+    ssd1306_canvas_t canvas;
+    for (uint8_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); l++) {
+        uint8_t tiles = (uint8_t)(layouts[l].tiles_x * layouts[l].tiles_y);
+        for (uint8_t shared = 0; shared < 2; shared++) {
+            for (uint8_t b = 0; b < sizeof(bus_hz) / sizeof(bus_hz[0]); b++) {
+                ssd1306_host_set_dma_bus_hz(0);
+                for (uint8_t p = 0; p < tiles; p++) {
+                    ssd1306_platform_init_panel(p, (uint8_t)(0x3C + p));
+                    ssd1306_host_set_panel_bus(p, shared ? 0 : p);
+                }
+                ssd1306_Canvas_Init(&canvas, buffer, layouts[l].tiles_x, layouts[l].tiles_y, panels);
+                ssd1306_Canvas_InitPanels(&canvas);
+                ssd1306_host_set_dma_bus_hz(bus_hz[b]);
+                ssd1306_host_set_time_us(0);
+
+                ssd1306_SetTarget(&canvas);
+                ssd1306_Clear();
+                ssd1306_FillCircle((int16_t)(layouts[l].tiles_x * 64), (int16_t)(layouts[l].tiles_y * 32), 30, true);
+                ssd1306_SetTarget(NULL);
+                ssd1306_Canvas_Flush(&canvas);
+                uint32_t t = 0;
+                while (!ssd1306_Canvas_Poll(&canvas)) {
+                    t += 10;
+                    ssd1306_host_set_time_us(t);
+                }
+                bench_entry_begin("canvas");
+                printf(", \"layout\": \"%s\", \"panels\": %u, \"buses\": %u, \"bus_hz\": %lu, \"frame_latency_us\": %lu",
+                       layouts[l].name, tiles, shared ? 1u : tiles, (unsigned long)bus_hz[b], (unsigned long)t);
+                bench_entry_end();
+            }
+        }
+    }
+    ssd1306_host_set_dma_bus_hz(0);
+    ssd1306_platform_init(0x3C);
+}
+
+// Flush worker. A renderer publishes 120 frames per second for 2 simulated seconds, animated for the first second
+// and static for the second, against the same frames flushed synchronously as they are rendered.
+
+static void bench_worker(void){
+    static const uint16_t fps[] = { 30, 60 };
+    static const uint32_t bus_hz[] = { 400000, 1000000 };
+    static uint8_t storage[3 * SSD1306_FRAME_SIZE];
+    static ssd1306_frames_t frames;
+    const uint32_t render_period_us = 1000000 / 120;
+    for (uint8_t f = 0; f < sizeof(fps) / sizeof(fps[0]); f++) {
+        for (uint8_t b = 0; b < sizeof(bus_hz) / sizeof(bus_hz[0]); b++) {
+            ssd1306_host_set_dma_bus_hz(bus_hz[b]);
+            ssd1306_host_set_time_us(0);
+            ssd1306_Frames_Init(&frames, storage);
+            ssd1306_Worker_Init(&frames, fps[f]);
+            ssd1306_host_reset_stats();
+            uint32_t rendered = 0;
+            uint32_t wake_us = 0;
+            bool ready = false;
+            for (uint32_t t = 0; t <= 2000000; t += 50) {
+                ssd1306_host_set_time_us(t);
+                if (t >= rendered * render_period_us) {
+                    uint8_t* back = ssd1306_Frames_Back(&frames);
+                    memset(back, 0, SSD1306_FRAME_SIZE);
+                    uint32_t x = rendered < 120 ? rendered : 120;
+                    for (uint8_t p = 0; p < 8; p++) back[p * 128 + x % 128] = 0xFF;
+                    ssd1306_Frames_Publish(&frames);
+                    rendered++;
+                    ready = true;
+                }
+                // The task sleeps until a frame is published or the time it asked for has passed.
+                if (ready || (wake_us != SSD1306_WORKER_IDLE && t >= wake_us)) {
+                    ready = false;
+                    uint32_t wait = ssd1306_Worker_Poll(t);
+                    wake_us = wait == SSD1306_WORKER_IDLE ? SSD1306_WORKER_IDLE : t + wait;
+                }
+            }
+            ssd1306_host_set_time_us(3000000);
+            ssd1306_platform_is_dma_done();
+            ssd1306_host_stats_t bus;
+            ssd1306_host_get_stats(&bus);
+            ssd1306_worker_stats_t stats;
+            ssd1306_Worker_GetStats(&stats);
+            bench_entry_begin("worker");
+            printf(", \"fps\": %u, \"bus_hz\": %lu, \"rendered\": %lu, \"sent\": %lu, \"merged\": %lu, \"skipped\": %lu, "
+                   "\"jitter_max_us\": %lu, \"jitter_avg_us\": %lu, \"bus_bytes\": %lu, \"sync_bus_bytes\": %lu",
+                   fps[f], (unsigned long)bus_hz[b], (unsigned long)rendered, (unsigned long)stats.frames_sent,
+                   (unsigned long)stats.frames_merged, (unsigned long)stats.frames_skipped,
+                   (unsigned long)stats.jitter_max_us, (unsigned long)stats.jitter_avg_us,
+                   (unsigned long)(bus.command_bytes + bus.data_bytes),
+                   // Synchronously every rendered frame is a window command plus the full frame.
+                   (unsigned long)(rendered * (8u + SSD1306_FRAME_SIZE)));
+            bench_entry_end();
+        }
+    }
+    ssd1306_host_set_dma_bus_hz(0);
+}
+
+// Rotation. The same portrait content drawn at SSD1306_ROTATE_90 and transposed at flush time, against the 90 degree
+// coordinates swapped per pixel onto the landscape frame buffer. Every operation is followed by ssd1306_UpdateDirty().
+
+typedef void (*bench_rotate_t)(uint32_t i, bool swap);
+
+static void bench_swap_pixel(int16_t x, int16_t y, bool color){
+    ssd1306_DrawPixel((uint8_t)(127 - y), (uint8_t)x, color);
+}
+
+static void bench_rotate_text(uint32_t i, bool swap){
+    static const char text[] = "portrait  ";
+    int16_t y = (int16_t)((i & 15) * 8);
+    if (!swap) {
+        ssd1306_WriteString(0, y, text, 10, Font_5x8, i & 16);
+        return;
+    }
+    for (uint8_t c = 0; c < 10; c++) {
+        const uint8_t* glyph = &Font_5x8.data[(text[c] - 32) * Font_5x8.width];
+        for (uint8_t col = 0; col < Font_5x8.width; col++) {
+            for (uint8_t r = 0; r < Font_5x8.height; r++)
+                bench_swap_pixel((int16_t)(c * (Font_5x8.width + 1) + col), (int16_t)(y + r), ((glyph[col] >> r) & 1) && (i & 16));
+        }
+    }
+}
+
+static void bench_rotate_fill(uint32_t i, bool swap){
+    if (!swap) {
+        ssd1306_FillRect(0, 0, 64, 128, i & 1);
+        return;
+    }
+    for (int16_t y = 0; y < 128; y++) {
+        for (int16_t x = 0; x < 64; x++)
+            bench_swap_pixel(x, y, i & 1);
+    }
+}
+
+static void bench_rotate_pixel(uint32_t i, bool swap){
+    int16_t x = (int16_t)(i & 63);
+    int16_t y = (int16_t)((i >> 6) & 127);
+    if (swap)
+        bench_swap_pixel(x, y, (i >> 13) & 1);
+    else
+        ssd1306_DrawPixel((uint8_t)x, (uint8_t)y, (i >> 13) & 1);
+}
+
+static void bench_rotation(void){
+    static const struct { const char* name; bench_rotate_t draw; } workloads[] = {
+        { "text_line", bench_rotate_text }, { "fill_screen", bench_rotate_fill }, { "pixel", bench_rotate_pixel },
+    };
+    static uint8_t portrait[128 * 64 / 8];
+    uint32_t count = iterations / 20 + 1;
+    for (uint8_t w = 0; w < sizeof(workloads) / sizeof(workloads[0]); w++) {
+        for (uint8_t swap = 0; swap < 2; swap++) {
+            ssd1306_SetRotation(swap ? SSD1306_ROTATE_0 : SSD1306_ROTATE_90, portrait);
+            ssd1306_Clear();
+            ssd1306_UpdateScreen();
+            ssd1306_host_reset_stats();
+            uint64_t start = bench_now_ns();
+            for (uint32_t i = 0; i < count; i++) {
+                workloads[w].draw(i, swap);
+                ssd1306_UpdateDirty();
+            }
+            uint64_t elapsed = bench_now_ns() - start;
+            ssd1306_host_stats_t bus;
+            ssd1306_host_get_stats(&bus);
+            bench_entry_begin("rotation");
+            printf(", \"workload\": \"%s\", \"mode\": \"%s\", \"ns_per_op\": %.1f, \"bytes_per_op\": %.1f",
+                   workloads[w].name, swap ? "pixel_swap" : "block_transpose", (double)elapsed / count,
+                   (double)(bus.command_bytes + bus.data_bytes) / count);
+            bench_entry_end();
+        }
+    }
+    ssd1306_SetRotation(SSD1306_ROTATE_0, NULL);
+}
+
+// A dashboard frame: a static grid and labels, a moving bar and needle. Redraw renders everything into the frame
+// buffer each frame, layered draws the static part once into the background and only the foreground each frame.
+
+static void bench_layers_static(void){
+    for (int16_t x = 0; x < 128; x += 16)
+        ssd1306_DrawLineStyle(x, 0, x, 63, 1, true, SSD1306_LINE_DOTTED);
+    for (int16_t y = 0; y < 64; y += 16)
+        ssd1306_DrawLineStyle(0, y, 127, y, 1, true, SSD1306_LINE_DOTTED);
+    ssd1306_WriteString(2, 2, "SPEED", 5, Font_5x8, true);
+    ssd1306_WriteString(90, 56, "km/h", 4, Font_5x8, true);
+}
+
+static void bench_layers_dynamic(uint32_t i){
+    ssd1306_FillRect(4, 50, (int16_t)(8 + i % 80), 6, true);
+    ssd1306_DrawNeedle(64, 40, 0, 24, (int16_t)(i % 180), 1, true);
+}
+
+static void bench_layers(void){
+    static uint8_t back[1024], fore[1024];
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t layered = 0; layered < 2; layered++) {
+        ssd1306_Clear();
+        if (layered) {
+            ssd1306_SetLayers(back, fore, NULL);
+            ssd1306_SelectLayer(SSD1306_LAYER_BACKGROUND);
+            bench_layers_static();
+            ssd1306_SelectLayer(SSD1306_LAYER_FOREGROUND);
+        }
+        ssd1306_UpdateScreen();
+        ssd1306_host_reset_stats();
+        ssd1306_ResetDrawStats();
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            ssd1306_Clear();
+            if (!layered)
+                bench_layers_static();
+            bench_layers_dynamic(i);
+            ssd1306_UpdateDirty();
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        ssd1306_host_stats_t bus;
+        ssd1306_host_get_stats(&bus);
+        ssd1306_draw_stats_t stats;
+        ssd1306_GetDrawStats(&stats);
+        bench_entry_begin("layers");
+        printf(", \"mode\": \"%s\", \"ns_per_frame\": %.1f, \"bytes_per_frame\": %.1f, \"writes_per_frame\": %.1f",
+               layered ? "layered" : "redraw", (double)elapsed / count, (double)(bus.command_bytes + bus.data_bytes) / count,
+               (double)(stats.pixel_writes + stats.column_writes) / count);
+        bench_entry_end();
+    }
+    ssd1306_SetLayers(NULL, NULL, NULL);
+}
+
+// A 40x24 widget and a text line drawn through the primitives every frame, against rendering them once into
+// off-screen surfaces and blitting, page aligned and at an unaligned row.
+
+static void bench_surface_widget(int16_t x, int16_t y){
+    ssd1306_DrawRect(x, y, 40, 24, 1, true);
+    ssd1306_FillCircle((int16_t)(x + 11), (int16_t)(y + 12), 8, true);
+    ssd1306_WriteString((int16_t)(x + 22), (int16_t)(y + 8), "42", 2, Font_5x8, true);
+}
+
+static void bench_surface(void){
+    static const char text[] = "Temperature 21.5C";
+    static uint8_t widget_buffer[3 * 40];
+    static uint8_t text_buffer[1 * 102];
+    ssd1306_surface_t widget, cached;
+    ssd1306_InitSurface(&widget, widget_buffer, 40, 24, 40);
+    ssd1306_InitSurface(&cached, text_buffer, 102, 8, 102);
+    ssd1306_SetSurface(&widget);
+    bench_surface_widget(0, 0);
+    ssd1306_SetSurface(&cached);
+    ssd1306_WriteString(0, 0, text, (uint8_t)(sizeof(text) - 1), Font_5x8, true);
+    ssd1306_SetSurface(NULL);
+
+    static const char* const modes[] = { "widget_draw", "widget_blit_aligned", "widget_blit_unaligned", "text_draw", "text_blit" };
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        ssd1306_Clear();
+        ssd1306_ResetDrawStats();
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            int16_t x = (int16_t)(i % 80);
+            switch (m) {
+            case 0: ssd1306_FillRect(x, 16, 40, 24, false); bench_surface_widget(x, 16); break;
+            case 1: ssd1306_Blit(&widget, 0, 0, 40, 24, x, 16); break;
+            case 2: ssd1306_Blit(&widget, 0, 0, 40, 24, x, 19); break;
+            case 3: ssd1306_FillRect(0, 24, 102, 8, false); ssd1306_WriteString(0, 24, text, (uint8_t)(sizeof(text) - 1), Font_5x8, true); break;
+            default: ssd1306_Blit(&cached, 0, 0, 102, 8, 0, 24); break;
+            }
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        ssd1306_draw_stats_t stats;
+        ssd1306_GetDrawStats(&stats);
+        bench_entry_begin("surface");
+        printf(", \"mode\": \"%s\", \"ns_per_op\": %.1f, \"writes_per_op\": %.1f", modes[m],
+               (double)elapsed / count, (double)(stats.pixel_writes + stats.column_writes) / count);
+        bench_entry_end();
+    }
+}
+
+// Word wrapped, centered text in a 100x40 box: the layout pass alone, drawing a cached layout, and laying out and
+// drawing every frame.
+
+static void bench_text(void){
+    static const char text[] = "Battery low, connect the charger or the device turns off in 5 minutes";
+    static const char* const modes[] = { "layout", "draw_cached", "layout_and_draw" };
+    ssd1306_text_layout_t layout;
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        ssd1306_Clear();
+        ssd1306_Text_Layout(&layout, text, sizeof(text) - 1, Font_5x8, 14, 12, 100, 40, SSD1306_ALIGN_CENTER,
+                            SSD1306_TEXT_WRAP | SSD1306_TEXT_ELLIPSIS);
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            if (m != 1)
+                ssd1306_Text_Layout(&layout, text, sizeof(text) - 1, Font_5x8, 14, 12, 100, 40, SSD1306_ALIGN_CENTER,
+                                    SSD1306_TEXT_WRAP | SSD1306_TEXT_ELLIPSIS);
+            if (m != 0)
+                ssd1306_Text_Draw(&layout, i & 1);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_entry_begin("text");
+        printf(", \"mode\": \"%s\", \"ns_per_op\": %.1f, \"lines\": %u, \"truncated\": %s", modes[m],
+               (double)elapsed / count, layout.line_count, layout.truncated ? "true" : "false");
+        bench_entry_end();
+    }
+}
+
+// Glyph lookup per character: the ASCII font indexed directly, ASCII through the first range of the European font,
+// accented letters of one range found by the last range cache, and alternating ranges that fall back to the binary search.
+
+static void bench_glyph(void){
+    static const uint32_t ascii[] = { 'T', 'e', 'm', 'p', ' ', '2', '1', 'C' };
+    static const uint32_t latin[] = { 0xE9, 0xE8, 0xE7, 0xE8, 0xE9, 0xE7, 0xE8, 0xE9 };
+    static const uint32_t mixed[] = { 0xB0, 0xDF, 0x20AC, 0xC4, 0xF6, 0x20AC, 0xB0, 0xFC };
+    static const struct { const char* mode; const FontDef* font; const uint32_t* codes; } cases[] = {
+        { "ascii_direct", &Font_5x8, ascii },
+        { "ascii_ranged", &Font_5x8_European, ascii },
+        { "latin_cached", &Font_5x8_European, latin },
+        { "mixed_search", &Font_5x8_European, mixed },
+    };
+    uint32_t count = iterations * 10 + 8;
+    for (uint8_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        const FontDef font = *cases[c].font;
+        uintptr_t sink = 0;
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            sink += (uintptr_t)ssd1306_Font_Glyph(font, cases[c].codes[i & 7]);
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        bench_entry_begin("glyph");
+        printf(", \"mode\": \"%s\", \"ns_per_op\": %.2f, \"found\": %s", cases[c].mode, (double)elapsed / count,
+               sink ? "true" : "false");
+        bench_entry_end();
+    }
+}
+
+// A 5 character readout scaled 2x, 3x and 4x: one rectangle per source pixel, columns spread through the lookup
+// tables, and spread columns taken from the glyph cache.
+
+static void bench_scale_fill_rect(const char* text, uint8_t scale){
+    for (uint8_t c = 0; text[c]; c++) {
+        const uint8_t* glyph = ssd1306_Font_Glyph(Font_5x8, (uint8_t)text[c]);
+        int16_t x = (int16_t)(c * 6 * scale);
+        for (uint8_t col = 0; col < 5; col++) {
+            for (uint8_t row = 0; row < 8; row++) {
+                if (glyph[col] & (1 << row))
+                    ssd1306_FillRect((int16_t)(x + col * scale), (int16_t)(8 + row * scale), scale, scale, true);
+            }
+        }
+    }
+}
+
+static void bench_scale(void){
+    static const char text[] = "12:45";
+    static const char* const modes[] = { "fill_rect", "spread", "spread_cached" };
+    static uint8_t cache[128];
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t scale = 2; scale <= SSD1306_SCALE_MAX; scale++) {
+        for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+            ssd1306_Clear();
+            ssd1306_Scale_SetCache(m == 2 ? cache : NULL, sizeof(cache));
+            ssd1306_ResetDrawStats();
+            uint64_t start = bench_now_ns();
+            for (uint32_t i = 0; i < count; i++) {
+                if (m == 0)
+                    bench_scale_fill_rect(text, scale);
+                else
+                    ssd1306_Scale_WriteString(0, 8, text, sizeof(text) - 1, Font_5x8, scale, true);
+            }
+            uint64_t elapsed = bench_now_ns() - start;
+            ssd1306_draw_stats_t stats;
+            ssd1306_GetDrawStats(&stats);
+            ssd1306_scale_stats_t cached;
+            ssd1306_Scale_GetStats(&cached);
+            bench_entry_begin("scale");
+            printf(", \"mode\": \"%s\", \"scale\": %u, \"ns_per_op\": %.1f, \"column_writes\": %.1f, "
+                   "\"pixel_writes\": %.1f, \"cache_hits\": %lu", modes[m], scale, (double)elapsed / count,
+                   (double)stats.column_writes / count, (double)stats.pixel_writes / count, (unsigned long)cached.hits);
+            bench_entry_end();
+        }
+    }
+    ssd1306_Scale_SetCache(NULL, 0);
+}
+
+// A counting "RPM: n" readout: clearing the field rectangle, writing the whole string and sending the frame every
+// update, against a text field that redraws the changed cells and sends them with ssd1306_UpdateDirty().
+
+static void bench_field(void){
+    static const char* const modes[] = { "clear_write_screen", "field_dirty" };
+    uint32_t count = iterations / 10 + 1;
+    for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        ssd1306_text_field_t field;
+        ssd1306_Text_FieldInit(&field, 0, 8, 11, Font_5x8, 1, SSD1306_ALIGN_LEFT, true);
+        ssd1306_Clear();
+        ssd1306_UpdateScreen();
+        ssd1306_host_reset_stats();
+        uint32_t cells = 0;
+        uint64_t start = bench_now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            char text[16];
+            int len = snprintf(text, sizeof(text), "RPM: %lu", (unsigned long)(800 + i % 6000));
+            if (m == 0) {
+                ssd1306_FillRect(0, 8, 66, 8, false);
+                ssd1306_WriteString(0, 8, text, (uint16_t)len, Font_5x8, true);
+                ssd1306_UpdateScreen();
+            } else {
+                ssd1306_Text_FieldSet(&field, text, (uint16_t)len);
+                ssd1306_UpdateDirty();
+                cells += field.redrawn;
+            }
+        }
+        uint64_t elapsed = bench_now_ns() - start;
+        ssd1306_host_stats_t stats;
+        ssd1306_host_get_stats(&stats);
+        bench_entry_begin("field");
+        printf(", \"mode\": \"%s\", \"ns_per_update\": %.1f, \"bytes_per_update\": %.1f, \"cells_per_update\": %.2f",
+               modes[m], (double)elapsed / count, (double)(stats.command_bytes + stats.data_bytes) / count,
+               m == 0 ? 11.0 : (double)cells / count);
+        bench_entry_end();
+    }
+}
+
+// Boot to a cleared, visible display. Classic: blocking reset delay, ssd1306_Init() and ssd1306_UpdateScreen(), timed
+// with the bus model. Fast: ssd1306_BootStart() and ssd1306_PowerPoll() on simulated time. Both are ready after tAF.
+
+static void bench_boot(void){
+    static const uint32_t bus_hz[] = { 400000, 1000000 };
+    for (uint8_t b = 0; b < sizeof(bus_hz) / sizeof(bus_hz[0]); b++) {
+        ssd1306_bus_cost_t init_cost = { 0 };
+        ssd1306_bus_cost_t frame_cost = { 0 };
+        ssd1306_host_set_dma_bus_hz(0);
+        ssd1306_platform_init(0x3C);
+        ssd1306_Init();
+        ssd1306_host_stats_t bus;
+        ssd1306_host_get_stats(&bus);
+        ssd1306_Bus_AddLog(&ssd1306_bus_stm32_hal, &init_cost);
+        uint32_t delay_us = bus.delay_us;
+        ssd1306_host_reset_stats();
+        ssd1306_Clear();
+        ssd1306_UpdateScreen();
+        ssd1306_Bus_AddLog(&ssd1306_bus_stm32_hal, &frame_cost);
+        uint32_t on_us = delay_us + ssd1306_Bus_TimeUs(&init_cost, bus_hz[b]);
+        uint32_t frame_us = ssd1306_Bus_TimeUs(&frame_cost, bus_hz[b]);
+        bench_entry_begin("boot");
+        printf(", \"path\": \"classic\", \"bus_hz\": %lu, \"transactions\": %lu, \"blocked_us\": %lu, "
+               "\"frame_us\": %lu, \"ready_us\": %lu",
+               (unsigned long)bus_hz[b], (unsigned long)(init_cost.frames + frame_cost.frames),
+               (unsigned long)(on_us + frame_us), (unsigned long)(on_us + frame_us),
+               (unsigned long)(on_us + (frame_us > SSD1306_POWER_ON_US ? frame_us : SSD1306_POWER_ON_US)));
+        bench_entry_end();
+
+        ssd1306_platform_init(0x3C);
+        ssd1306_host_set_dma_bus_hz(bus_hz[b]);
+        ssd1306_host_set_time_us(0);
+        ssd1306_host_reset_stats();
+        ssd1306_Clear();
+        uint32_t t = 0;
+        ssd1306_BootStart(t);
+        while (!ssd1306_PowerPoll(t)) {
+            t += 10;
+            ssd1306_host_set_time_us(t);
+        }
+        ssd1306_boot_stats_t boot;
+        ssd1306_GetBootStats(&boot);
+        ssd1306_host_get_stats(&bus);
+        bench_entry_begin("boot");
+        printf(", \"path\": \"fast\", \"bus_hz\": %lu, \"transactions\": %lu, \"blocked_us\": %lu, "
+               "\"frame_us\": %lu, \"ready_us\": %lu",
+               (unsigned long)bus_hz[b], (unsigned long)bus.transactions, (unsigned long)bus.delay_us,
+               (unsigned long)boot.frame_us, (unsigned long)boot.ready_us);
+        bench_entry_end();
+    }
+    ssd1306_host_set_dma_bus_hz(0);
+    ssd1306_platform_init(0x3C);
+    ssd1306_Init();
+}
+
+int main(int argc, char** argv){
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            iterations = 200;
+        } else {
+            fprintf(stderr, "usage: %s [--quick]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    ssd1306_platform_init(0x3C);
+    if (!ssd1306_Init()) {
+        fprintf(stderr, "ssd1306_Init failed\n");
+        return 1;
+    }
+    for (uint16_t i = 0; i < sizeof(bench_bitmap); i++) {
+        bench_bitmap[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    static const int16_t sizes[] = { 8, 32, 64, 128 };
+    static const int16_t text_sizes[] = { 24, 64, 126 };
+    const uint8_t size_count = sizeof(sizes) / sizeof(sizes[0]);
+
+    printf("{\n  \"version\": \"%s\",\n  \"iterations\": %lu,\n  \"results\": [", SSD1306_BENCH_VERSION, (unsigned long)iterations);
+    bench_primitive("draw_pixel", bench_pixel, sizes, 1);
+    bench_primitive("draw_line", bench_line, sizes, size_count);
+    bench_primitive("fill_rect", bench_fill_rect, sizes, size_count);
+    bench_primitive("draw_circle", bench_circle, sizes, size_count - 1);
+    bench_primitive("fill_circle", bench_fill_circle, sizes, size_count - 1);
+    bench_primitive("fill_poly", bench_fill_poly, sizes, size_count - 1);
+    bench_primitive("fill_rect_pattern", bench_fill_rect_pattern, sizes, size_count);
+    bench_primitive("pattern_pixel_loop", bench_pattern_pixels, sizes, size_count);
+    bench_primitive("fill_circle_pattern", bench_fill_circle_pattern, sizes, size_count - 1);
+    bench_primitive("fill_poly_pattern", bench_fill_poly_pattern, sizes, size_count - 1);
+    bench_primitive("draw_line_dashed", bench_dashed_line, sizes, size_count);
+    bench_primitive("draw_arc", bench_draw_arc, sizes, size_count - 1);
+    bench_primitive("fill_pie", bench_fill_pie, sizes, size_count - 1);
+    bench_primitive("fill_rect_rotated", bench_fill_rect_rotated, sizes, size_count - 1);
+    bench_primitive("draw_bitmap", bench_draw_bitmap, sizes, size_count);
+    bench_primitive("write_string", bench_write_string, text_sizes, sizeof(text_sizes) / sizeof(text_sizes[0]));
+    bench_flood(sizes, size_count - 1);
+    bench_gauge();
+    bench_flush();
+    bench_bus();
+    bench_console();
+    bench_gray();
+    bench_dither();
+    bench_video();
+    bench_canvas();
+    bench_worker();
+    bench_boot();
+    bench_rotation();
+    bench_layers();
+    bench_surface();
+    bench_text();
+    bench_glyph();
+    bench_scale();
+    bench_field();
+    printf("\n  ]\n}\n");
+    return 0;
+}
@@ -4,19 +4,119 @@
 *   Author: Ikshwak Jinesh 
 */
 #include "ssd1306.h"
+#include <stdlib.h>
+#include <string.h>
 
 #define SSD1306_WIDTH    128
 #define SSD1306_HEIGHT   64
+#define SSD1306_PAGES    (SSD1306_HEIGHT / 8)
 #define SSD1306_BUFFER_SIZE  (SSD1306_WIDTH * SSD1306_HEIGHT / 8)
-
-#ifndef pi
-#define pi 3.1415926f
+#define SSD1306_PORTRAIT_WIDTH  SSD1306_HEIGHT
+#define SSD1306_PORTRAIT_PAGES  (SSD1306_WIDTH / 8)
+
+// Held while a flush sends its commands, so a flush started from another task or an interrupt backs off instead of
+// interleaving its commands. Taken with an atomic test and set, a plain flag could be taken by both. Drawing does
+// not take it.
+static bool frame_lock = false;
+// Panels whose DMA transfer may still be reading the frame buffer, bit n for panel n. Flushes that rewrite the
+// buffer wait for them, transfers of other frames (ssd1306_SendFrame()) are not tracked here. Changed under frame_lock.
+static uint32_t frame_readers = 0;
+
+
+// Initialization sequence (from datasheet)
+static const uint8_t init_seq[] = {
+    0xAE,             // Display OFF
+    0x20, 0x00,       // Memory Addressing Mode: Horizontal
+    0xB0,             // Set Page Start Address for Page Addressing Mode
+    0xC8,             // COM Output Scan Direction: remapped
+    0x00,             // Low column address
+    0x10,             // High column address
+    0x40,             // Set start line at 0
+    0x81, 0x7F,       // Set contrast to 0x7F
+    0xA1,             // Segment re-map: column address 127 is mapped to SEG0
+    0xA6,             // Normal display
+    0xA8, 0x3F,       // Multiplex ratio = 64
+    0xA4,             // Output follows RAM content
+    0xD3, 0x00,       // Display offset = 0
+    0xD5, 0x80,       // Display clock div ratio = 0x0, osc freq = 0x8
+    0xD9, 0xF1,       // Pre-charge period
+    0xDA, 0x12,       // COM pins hardware config
+    0xDB, 0x40,       // VCOMH deselect level
+    0x8D, 0x14,       // Charge pump settings: enable
+    0xAF              // Display ON
+};
+
+// ssd1306_BootStart() sends the init sequence with a full window ahead of display ON, then the first frame, as one stream.
+static const uint8_t boot_window[] = { 0x21, 0x00, SSD1306_WIDTH - 1, 0x22, 0x00, SSD1306_PAGES - 1 };
+#define SSD1306_BOOT_COMMANDS (sizeof(init_seq) + sizeof(boot_window))
+#define SSD1306_BOOT_PREFIX   (2 * SSD1306_BOOT_COMMANDS + 1)
+
+// The frame buffer is preceded by room for the boot commands, so the stream is sent without a copy.
+static uint8_t frame_tx[SSD1306_BOOT_PREFIX + SSD1306_BUFFER_SIZE];
+static uint8_t* const buffer = &frame_tx[SSD1306_BOOT_PREFIX];
+
+// GDDRAM row currently mapped to COM0 through the display start line. The buffer and the GDDRAM are
+// treated as a vertical ring, drawing coordinates are offset by this value so the screen stays fixed.
+static uint8_t scroll_offset = 0;
+// The ring has moved since the last flush. The flush that sends the exposed rows queues the new start line, which goes
+// out once that transfer is done so the rows are in GDDRAM before they become visible.
+static bool start_line_pending = false;
+static bool start_line_queued = false;
+static uint8_t start_line_value = 0;
+
+// Column span of every page that has been modified since it was last sent, dirty_x0 > dirty_x1 marks a clean page.
+// Everything starts dirty since the GDDRAM content is unknown at power up.
+static uint8_t dirty_x0[SSD1306_PAGES] = { 0 };
+static uint8_t dirty_x1[SSD1306_PAGES] = {
+    SSD1306_WIDTH - 1, SSD1306_WIDTH - 1, SSD1306_WIDTH - 1, SSD1306_WIDTH - 1,
+    SSD1306_WIDTH - 1, SSD1306_WIDTH - 1, SSD1306_WIDTH - 1, SSD1306_WIDTH - 1
+};
+
+// Canvas the drawing functions write into, NULL for the screen frame buffer.
+static ssd1306_canvas_t* target = NULL;
+
+// Off-screen surface the drawing functions write into, ahead of the canvas, layers and portrait buffer. NULL when unused.
+static ssd1306_surface_t* surface = NULL;
+
+// Drawing buffer of the 90 and 270 degree rotations, NULL otherwise. 64 columns by 16 pages, its dirty column spans
+// are transposed into the frame buffer in 8x8 blocks before each flush.
+static uint8_t* portrait = NULL;
+static uint8_t portrait_x0[SSD1306_PORTRAIT_PAGES];
+static uint8_t portrait_x1[SSD1306_PORTRAIT_PAGES];
+
+// Layer buffers while layered drawing is on, NULL otherwise, and the selected layer drawing goes into. Every layer
+// keeps the column span of each page drawn into since it was last cleared, so clearing a layer only touches what was
+// drawn. The compose spans are the columns to recombine into the frame buffer at the next flush.
+static uint8_t* layers[SSD1306_LAYER_COUNT] = { NULL };
+static uint8_t* layer = NULL;
+static uint8_t layer_index = SSD1306_LAYER_FOREGROUND;
+static uint8_t layer_x0[SSD1306_LAYER_COUNT][SSD1306_PAGES];
+static uint8_t layer_x1[SSD1306_LAYER_COUNT][SSD1306_PAGES];
+static uint8_t compose_x0[SSD1306_PAGES];
+static uint8_t compose_x1[SSD1306_PAGES];
+
+// Built in fill patterns, columns with the LSB at the top.
+const ssd1306_pattern_t ssd1306_pattern_gray25 = { { 0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00 } };
+const ssd1306_pattern_t ssd1306_pattern_gray50 = { { 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA } };
+const ssd1306_pattern_t ssd1306_pattern_gray75 = { { 0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF, 0x55, 0xFF } };
+const ssd1306_pattern_t ssd1306_pattern_hatch  = { { 0x11, 0x88, 0x44, 0x22, 0x11, 0x88, 0x44, 0x22 } };
+const ssd1306_pattern_t ssd1306_pattern_cross  = { { 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x44, 0xAA } };
+
+// Non-blocking power sequencing, advanced by ssd1306_PowerPoll().
+static ssd1306_power_state_t power_state = SSD1306_POWER_OFF;
+static uint32_t power_deadline_us = 0;
+static bool booting = false;
+static uint32_t boot_start_us = 0;
+static ssd1306_boot_stats_t boot_stats;
+
+#ifdef SSD1306_ENABLE_STATS
+static ssd1306_draw_stats_t draw_stats;
+#define SSD1306_COUNT(field) (draw_stats.field++)
+#define SSD1306_COUNT_N(field, n) (draw_stats.field += (n))
+#else
+#define SSD1306_COUNT(field) ((void)0)
+#define SSD1306_COUNT_N(field, n) ((void)0)
 #endif
-// Flags to protect the display frames from different functions when modifying it.
-volatile bool frame_is_free = true;
-
-
-static uint8_t buffer[SSD1306_BUFFER_SIZE];
 
 
 // Internal helper functions.
@@ -56,6 +156,18 @@ static bool ssd1306_WriteMultiCommand(const uint8_t* cmds, uint16_t size){
     return ssd1306_platform_write_multi_command(cmds, size);
 }
 
+/**
+ * @brief  Provides a blocking delay for the required period.
+ * @param  us Time to delay for in microseconds. 
+ * @retval true if delay has been successfully completed, false otherwise. 
+ */
+static bool ssd1306_DelayUs(uint32_t us){
+    if(ssd1306_platform_delay_us(us)){
+        return true;
+    }
+    return false;
+}
+
 /**
  * @brief  Hardware reset pulse.
  * @retval true if successfully reintialized the I2C bus, false otherwise. 
@@ -63,19 +175,141 @@ static bool ssd1306_WriteMultiCommand(const uint8_t* cmds, uint16_t size){
 static bool ssd1306_Reset(void){
     // If your platform supports a reset pin, toggle it here.
     // Otherwise just delay to allow internal reset.
-    return ssd1306_DelayUs(2000);
+    return ssd1306_DelayUs(SSD1306_RESET_US);
 }
 
+// Dirty page tracking for partial updates.
 /**
- * @brief  Provides a blocking delay for the required period.
- * @param  us Time to delay for in microseconds. 
- * @retval true if delay has been successfully completed, false otherwise. 
+ * @brief  Drops the panels whose transfer has left the frame buffer from frame_readers. Each bus is checked like
+ *         ssd1306_Canvas_Poll() does, the selection is restored.
  */
-static bool ssd1306_DelayUs(uint32_t us){
-    if(ssd1306_platform_delay_us(us)){
+static void ssd1306_RetireReaders(void) {
+    if (!frame_readers) {
+        return;
+    }
+    uint8_t selected = ssd1306_platform_selected();
+    for (uint8_t panel = 0; panel < SSD1306_MAX_PANELS; panel++) {
+        if ((frame_readers >> panel & 1) && ssd1306_platform_select(panel) && ssd1306_platform_is_dma_done()) {
+            frame_readers &= ~(1u << panel);
+        }
+    }
+    ssd1306_platform_select(selected);
+}
+
+/**
+ * @brief  Takes the frame lock for a flush on the selected panel. The flush backs off while a transfer is still on the
+ *         bus of the panel, its commands would cut into it, and when it rewrites the frame buffer, while a transfer
+ *         on any panel still reads it.
+ * @param  rewrite true if the flush composes layers or the portrait buffer into the frame buffer.
+ */
+static bool ssd1306_FrameAcquire(bool rewrite) {
+    if (__atomic_test_and_set(&frame_lock, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    ssd1306_RetireReaders();
+    if (!ssd1306_platform_is_dma_done() || (rewrite && frame_readers)) {
+        __atomic_clear(&frame_lock, __ATOMIC_RELEASE);
+        return false;
+    }
+    return true;
+}
+
+static inline void ssd1306_FrameRelease(void) {
+    __atomic_clear(&frame_lock, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief  Records a started transfer of the frame buffer on the selected panel until it is done. Blocking platforms
+ *         have already finished it.
+ */
+static inline void ssd1306_FrameReading(bool started) {
+    if (started && !ssd1306_platform_is_dma_done()) {
+        frame_readers |= 1u << ssd1306_platform_selected();
+    }
+}
+
+static inline void ssd1306_MarkDirtySpan(uint8_t page, uint8_t x0, uint8_t x1) {
+    if (x0 < dirty_x0[page]) dirty_x0[page] = x0;
+    if (x1 > dirty_x1[page]) dirty_x1[page] = x1;
+}
+
+static inline void ssd1306_MarkAllDirty(void) {
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        dirty_x0[page] = 0;
+        dirty_x1[page] = SSD1306_WIDTH - 1;
+    }
+}
+
+static inline void ssd1306_MarkPortraitDirty(uint8_t page, uint8_t x) {
+    if (x < portrait_x0[page]) portrait_x0[page] = x;
+    if (x > portrait_x1[page]) portrait_x1[page] = x;
+}
+
+static inline void ssd1306_MarkPortraitAllDirty(void) {
+    memset(portrait_x0, 0, sizeof(portrait_x0));
+    memset(portrait_x1, SSD1306_PORTRAIT_WIDTH - 1, sizeof(portrait_x1));
+}
+
+static inline void ssd1306_MarkComposeSpan(uint8_t page, uint8_t x0, uint8_t x1) {
+    if (x0 < compose_x0[page]) compose_x0[page] = x0;
+    if (x1 > compose_x1[page]) compose_x1[page] = x1;
+}
+
+static inline void ssd1306_MarkLayerSpan(uint8_t page, uint8_t x0, uint8_t x1) {
+    if (x0 < layer_x0[layer_index][page]) layer_x0[layer_index][page] = x0;
+    if (x1 > layer_x1[layer_index][page]) layer_x1[layer_index][page] = x1;
+    ssd1306_MarkComposeSpan(page, x0, x1);
+}
+
+static inline void ssd1306_MarkLayerDirty(uint8_t page, uint8_t x) {
+    ssd1306_MarkLayerSpan(page, x, x);
+}
+
+static inline void ssd1306_MarkAllClean(void) {
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        dirty_x0[page] = 0xFF;
+        dirty_x1[page] = 0;
+    }
+}
+
+/**
+ * @brief  Sets horizontal addressing and the column and page window in a single command sequence.
+ * @param  x0 First column of the window (0, 127).
+ * @param  x1 Last column of the window (0, 127).
+ * @param  page0 First page of the window (0, 7).
+ * @param  page1 Last page of the window (0, 7).
+ * @retval true if the window has been set, false otherwise.
+ */
+static bool ssd1306_SetWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1){
+    const uint8_t cmd[] = { 0x20, 0x00, 0x21, x0, x1, 0x22, page0, page1 };
+    return ssd1306_WriteMultiCommand(cmd, sizeof(cmd));
+}
+
+/**
+ * @brief  Queues the start line of a ring scroll behind the flush that has just started sending the exposed rows.
+ */
+static inline void ssd1306_QueueStartLine(void){
+    if (start_line_pending) {
+        start_line_value = scroll_offset;
+        start_line_queued = true;
+        start_line_pending = false;
+    }
+}
+
+/**
+ * @brief  Sends the queued start line once the transfer carrying the exposed rows is done. While a background
+ *         transfer is still on the wire it stays queued for ssd1306_FlushPoll() or the next flush.
+ * @retval true if nothing is queued any more, false otherwise.
+ */
+static bool ssd1306_FlushStartLine(void){
+    if (!start_line_queued) {
         return true;
     }
-    return false;
+    if (!ssd1306_platform_is_dma_done() || !ssd1306_SetStartLine(start_line_value)) {
+        return false;
+    }
+    start_line_queued = false;
+    return true;
 }
 
 /**
@@ -104,7 +338,7 @@ static int8_t IsAntiClockwise(int16_t x, int16_t y, int16_t x0, int16_t y0, int1
  * @param  results Pointer to an array of bool values of the size point_count. true if inside the polygon, false otherwise.
  * @retval true if the check has completed successfully, false otherwise. 
  */
-static bool InPoly(uint8_t* x0, uint8_t* y0, uint16_t point_count, int16_t* x, int16_t* y, uint8_t vertex_count, bool* results){
+static bool InPoly(int16_t* x0, int16_t* y0, uint16_t point_count, int16_t* x, int16_t* y, uint8_t vertex_count, bool* results){
     if (vertex_count < 3 || point_count < 1)
         return false;
 
@@ -145,78 +379,21 @@ static bool InPoly(uint8_t* x0, uint8_t* y0, uint16_t point_count, int16_t* x, i
     return true;
 }
 
-// The following function is the added angle method to calculate if the points are within a polygon. Use it only if absolutely needed. 
-// It is too slow for realtime display.
-/*
-static bool InPoly(uint8_t* x0, uint8_t* y0, uint16_t point_count, int16_t* x, int16_t* y, uint8_t vertex_count, bool* results){
-    if(vertex_count < 3 || point_count < 1){
-        return false;
-    }
-    float v_x1, v_x2, v_y1, v_y2,p_x, p_y,dot, cross, len1, len2 ,angle, angle_sum;  
-    float EPSILON = 0.05;
-    for (uint16_t i = 0; i < point_count; i++) {
-        p_x = x0[i];
-        p_y = y0[i];
-        angle_sum = 0.0;
-
-        for (uint8_t j = 0; j < vertex_count; j++) {
-            v_x1 = x[j] - p_x;
-            v_y1 = y[j] - p_y;
-            v_x2 = x[(j + 1) % vertex_count] - p_x;
-            v_y2 = y[(j + 1) % vertex_count] - p_y;
-
-            float dot = v_x1 * v_x2 + v_y1 * v_y2;
-            float cross = v_x1 * v_y2 - v_y1 * v_x2;
-            float len1 = sqrtf(v_x1 * v_x1 + v_y1 * v_y1);
-            float len2 = sqrtf(v_x2 * v_x2 + v_y2 * v_y2);
-
-            if (len1 == 0 || len2 == 0) {
-                angle_sum = 0;
-                break;  // Point coincides with a vertex; treat as on edge
-            }
-
-            float angle = atan2f(cross, dot);  // Signed angle
-            angle_sum += angle;
-            if(fabs(angle_sum - 2*pi) < EPSILON){ // pi is defined, and is 3.14.
-                results[i] = true;
-            }
-            else{
-                results[i] = false;
-            }
-        }
-
-    }
-    return true;
-}
-*/
-
 bool ssd1306_Init(void){
     // reset
     if (!ssd1306_Reset()) return false;
 
-    // Initialization sequence (from datasheet)
-    const uint8_t init_seq[] = {
-        0xAE,             // Display OFF
-        0x20, 0x00,       // Memory Addressing Mode: Horizontal
-        0xB0,             // Set Page Start Address for Page Addressing Mode
-        0xC8,             // COM Output Scan Direction: remapped
-        0x00,             // Low column address
-        0x10,             // High column address
-        0x40,             // Set start line at 0
-        0x81, 0x7F,       // Set contrast to 0x7F
-        0xA1,             // Segment re-map: column address 127 is mapped to SEG0
-        0xA6,             // Normal display
-        0xA8, 0x3F,       // Multiplex ratio = 64
-        0xA4,             // Output follows RAM content
-        0xD3, 0x00,       // Display offset = 0
-        0xD5, 0x80,       // Display clock div ratio = 0x0, osc freq = 0x8
-        0xD9, 0xF1,       // Pre-charge period
-        0xDA, 0x12,       // COM pins hardware config
-        0xDB, 0x40,       // VCOMH deselect level
-        0x8D, 0x14,       // Charge pump settings: enable
-        0xAF              // Display ON
-    };
-    return ssd1306_WriteData(init_seq, sizeof(init_seq));
+    // The sequence below sets the start line back to 0 and the upright orientation, the GDDRAM content is unknown
+    // until the first flush.
+    scroll_offset = 0;
+    start_line_pending = false;
+    start_line_queued = false;
+    portrait = NULL;
+    memset(layers, 0, sizeof(layers));
+    layer = NULL;
+    ssd1306_MarkAllDirty();
+
+    return ssd1306_WriteMultiCommand(init_seq, sizeof(init_seq));
 }
 
 bool ssd1306_SetDisplayOffset(uint8_t offset){
@@ -274,36 +451,335 @@ bool ssd1306_Wake(void){
 bool ssd1306_PowerOnSequence(void){
     // Often just Init covers this; but to mirror datasheet:
     if (!ssd1306_WriteCommand(0xAF)) return false; // Display ON
-    return ssd1306_DelayUs(100000);                 // tAF = 100 ms
+    return ssd1306_DelayUs(SSD1306_POWER_ON_US);
 }
 
 bool ssd1306_PowerOffSequence(void){
     if (!ssd1306_WriteCommand(0xAE)) return false; // Display OFF
-    return ssd1306_DelayUs(100000);                // tOFF = 100 ms
+    return ssd1306_DelayUs(SSD1306_POWER_OFF_US);
+}
+
+bool ssd1306_BootStart(uint32_t now_us){
+    scroll_offset = 0;
+    start_line_pending = false;
+    start_line_queued = false;
+    portrait = NULL;
+    memset(layers, 0, sizeof(layers));
+    layer = NULL;
+    memset(&boot_stats, 0, sizeof(boot_stats));
+    booting = true;
+    boot_start_us = now_us;
+    // The reset time runs from power up, which now_us counts from; only what is left of it is waited for.
+    power_deadline_us = now_us < SSD1306_RESET_US ? SSD1306_RESET_US : now_us;
+    power_state = SSD1306_POWER_RESET;
+    ssd1306_PowerPoll(now_us);
+    return true;
+}
+
+bool ssd1306_PowerOnStart(uint32_t now_us){
+    if (!ssd1306_WriteCommand(0xAF)) return false;
+    booting = false;
+    power_deadline_us = now_us + SSD1306_POWER_ON_US;
+    power_state = SSD1306_POWER_SETTLING;
+    return true;
+}
+
+bool ssd1306_PowerOffStart(uint32_t now_us){
+    if (!ssd1306_WriteCommand(0xAE)) return false;
+    booting = false;
+    power_deadline_us = now_us + SSD1306_POWER_OFF_US;
+    power_state = SSD1306_POWER_STOPPING;
+    return true;
+}
+
+bool ssd1306_PowerPoll(uint32_t now_us){
+    switch (power_state) {
+        case SSD1306_POWER_RESET: {
+            if ((int32_t)(now_us - power_deadline_us) < 0) return false;
+            if (!ssd1306_FrameAcquire(true)) return false;
+            // Co = 1 control and command pairs, then 0x40 and the frame buffer as data, in one transaction.
+            // SEG/COM stay off for tAF after display ON, long enough for the frame to land before anything shows.
+            uint8_t* prefix = frame_tx;
+            for (uint8_t i = 0; i < sizeof(init_seq) - 1; i++) {
+                *prefix++ = 0x80;
+                *prefix++ = init_seq[i];
+            }
+            for (uint8_t i = 0; i < sizeof(boot_window); i++) {
+                *prefix++ = 0x80;
+                *prefix++ = boot_window[i];
+            }
+            *prefix++ = 0x80;
+            *prefix++ = init_seq[sizeof(init_seq) - 1];
+            *prefix = 0x40;
+            bool started = ssd1306_platform_start_stream_dma(frame_tx, sizeof(frame_tx));
+            if (started) {
+                ssd1306_MarkAllClean();
+            }
+            ssd1306_FrameReading(started);
+            ssd1306_FrameRelease();
+            if (!started) return false;
+            boot_stats.loading_us = now_us - boot_start_us;
+            boot_stats.transactions++;
+            power_deadline_us = now_us + SSD1306_POWER_ON_US;
+            power_state = SSD1306_POWER_LOADING;
+        }
+        // fall through
+        case SSD1306_POWER_LOADING:
+            if (!ssd1306_platform_is_dma_done()) return false;
+            boot_stats.frame_us = now_us - boot_start_us;
+            power_state = SSD1306_POWER_SETTLING;
+            // fall through
+        case SSD1306_POWER_SETTLING:
+            if ((int32_t)(now_us - power_deadline_us) < 0) return false;
+            if (booting) {
+                boot_stats.ready_us = now_us - boot_start_us;
+                booting = false;
+            }
+            power_state = SSD1306_POWER_ON;
+            return true;
+        case SSD1306_POWER_STOPPING:
+            if ((int32_t)(now_us - power_deadline_us) < 0) return false;
+            power_state = SSD1306_POWER_OFF;
+            return true;
+        default:
+            return true;
+    }
+}
+
+ssd1306_power_state_t ssd1306_GetPowerState(void){
+    return power_state;
+}
+
+void ssd1306_GetBootStats(ssd1306_boot_stats_t* stats){
+    *stats = boot_stats;
+}
+
+/**
+ * @brief  Transposes an 8x8 bit block, Hacker's Delight 7-3.
+ * @param  in Eight row bytes, the MSB is the leftmost pixel.
+ * @param  stride Distance between the row bytes.
+ * @param  out Eight column bytes, the LSB is the top row.
+ */
+static void ssd1306_Transpose8(const uint8_t* in, uint16_t stride, uint8_t* out) {
+    // Rows are loaded bottom up so the top row ends in the LSB of every column.
+    uint32_t x = ((uint32_t)in[7 * stride] << 24) | ((uint32_t)in[6 * stride] << 16) | ((uint32_t)in[5 * stride] << 8) | in[4 * stride];
+    uint32_t y = ((uint32_t)in[3 * stride] << 24) | ((uint32_t)in[2 * stride] << 16) | ((uint32_t)in[1 * stride] << 8) | in[0];
+    uint32_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AAu;  x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AAu;  y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCCu; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCCu; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0u) | ((y >> 4) & 0x0F0F0F0Fu);
+    y = ((x << 4) & 0xF0F0F0F0u) | (y & 0x0F0F0F0Fu);
+    x = t;
+    out[0] = (uint8_t)(x >> 24); out[1] = (uint8_t)(x >> 16); out[2] = (uint8_t)(x >> 8); out[3] = (uint8_t)x;
+    out[4] = (uint8_t)(y >> 24); out[5] = (uint8_t)(y >> 16); out[6] = (uint8_t)(y >> 8); out[7] = (uint8_t)y;
+}
+
+/**
+ * @brief  Copies the modified 8x8 blocks of the portrait buffer into the frame buffer, rotated by 90 degrees.
+ *         Portrait row y lands in panel column 127 - y and portrait column x in panel row x, which is a plain
+ *         transpose of every block. 270 degrees is the same layout shown through the hardware 180 degree remap.
+ */
+static void ssd1306_RotateDirty(void) {
+    if (!portrait)
+        return;
+    for (uint8_t page = 0; page < SSD1306_PORTRAIT_PAGES; page++) {
+        if (portrait_x0[page] > portrait_x1[page])
+            continue;
+        uint8_t column = (uint8_t)(SSD1306_WIDTH - 8 - page * 8);
+        for (uint8_t block = portrait_x0[page] >> 3; block <= portrait_x1[page] >> 3; block++) {
+            ssd1306_Transpose8(&portrait[page * SSD1306_PORTRAIT_WIDTH + block * 8], 1, &buffer[block * SSD1306_WIDTH + column]);
+            ssd1306_MarkDirtySpan(block, column, (uint8_t)(column + 7));
+        }
+        portrait_x0[page] = 0xFF;
+        portrait_x1[page] = 0;
+    }
+}
+
+/**
+ * @brief  Recombines the compose spans of the layers into the frame buffer, background AND NOT mask OR foreground,
+ *         a byte of every layer at a time. Only the columns whose composed byte changed are marked for sending.
+ */
+static void ssd1306_ComposeDirty(void) {
+    if (!layers[SSD1306_LAYER_BACKGROUND])
+        return;
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (compose_x0[page] > compose_x1[page])
+            continue;
+        uint16_t base = (uint16_t)(page * SSD1306_WIDTH);
+        const uint8_t* back = &layers[SSD1306_LAYER_BACKGROUND][base];
+        const uint8_t* fore = &layers[SSD1306_LAYER_FOREGROUND][base];
+        const uint8_t* mask = layers[SSD1306_LAYER_MASK] ? &layers[SSD1306_LAYER_MASK][base] : NULL;
+        uint8_t* out = &buffer[base];
+        int16_t first = -1, last = -1;
+        for (int16_t x = compose_x0[page]; x <= compose_x1[page]; x++) {
+            uint8_t composed = (uint8_t)((mask ? back[x] & ~mask[x] : back[x]) | fore[x]);
+            if (composed == out[x])
+                continue;
+            out[x] = composed;
+            if (first < 0)
+                first = x;
+            last = x;
+        }
+        if (first >= 0)
+            ssd1306_MarkDirtySpan(page, (uint8_t)first, (uint8_t)last);
+        compose_x0[page] = 0xFF;
+        compose_x1[page] = 0;
+    }
 }
 
 bool ssd1306_Clear(void){
+    if (surface) {
+        for (uint16_t page = 0; page < (surface->height + 7) / 8; page++)
+            memset(&surface->buffer[(uint32_t)page * surface->stride], 0, surface->width);
+        return true;
+    }
+    if (target) {
+        uint8_t tiles = (uint8_t)(target->tiles_x * target->tiles_y);
+        memset(target->buffer, 0, (size_t)tiles * SSD1306_BUFFER_SIZE);
+        target->dirty_tiles = (uint16_t)((1ul << tiles) - 1);
+        return true;
+    }
+    if (portrait) {
+        memset(portrait, 0, SSD1306_BUFFER_SIZE);
+        ssd1306_MarkPortraitAllDirty();
+        return true;
+    }
+    if (layer) {
+        // Only the columns drawn into since the last clear can be set.
+        for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+            uint8_t x0 = layer_x0[layer_index][page];
+            uint8_t x1 = layer_x1[layer_index][page];
+            if (x0 > x1)
+                continue;
+            memset(&layer[page * SSD1306_WIDTH + x0], 0, (size_t)(x1 - x0 + 1));
+            ssd1306_MarkComposeSpan(page, x0, x1);
+            layer_x0[layer_index][page] = 0xFF;
+            layer_x1[layer_index][page] = 0;
+        }
+        return true;
+    }
     memset(buffer, 0, SSD1306_BUFFER_SIZE);
+    ssd1306_MarkAllDirty();
     return true;
 }
 
 bool ssd1306_UpdateScreen(void){
 
-    if(!frame_is_free){
+    if (!ssd1306_FrameAcquire(true)) {
         return false;
     }
-    frame_is_free = false;
+    // A start line still queued by the previous transfer goes out ahead of this one.
+    ssd1306_FlushStartLine();
+    ssd1306_RotateDirty();
+    ssd1306_ComposeDirty();
     // set page and column addresses to full screen
-    if (!ssd1306_SetMemoryAddressingMode(0x00)) return false;
-    if (!ssd1306_SetColumnAddress(0, SSD1306_WIDTH - 1)) return false;
-    if (!ssd1306_SetPageAddress(0, (SSD1306_HEIGHT/8) - 1)) return false;
+    if (!ssd1306_SetWindow(0, SSD1306_WIDTH - 1, 0, SSD1306_PAGES - 1)) {
+        ssd1306_FrameRelease();
+        return false;
+    }
 
     // send all buffer via DMA or blocking
-    if(ssd1306_platform_start_data_dma(buffer, SSD1306_BUFFER_SIZE)){
-        frame_is_free = true;
-        return true;
+    bool started = ssd1306_platform_start_data_dma(buffer, SSD1306_BUFFER_SIZE);
+    if (started) {
+        ssd1306_MarkAllClean();
+        ssd1306_QueueStartLine();
+        ssd1306_FlushStartLine();
     }
-    return false;
+    ssd1306_FrameReading(started);
+    ssd1306_FrameRelease();
+    return started;
+}
+
+bool ssd1306_SendFrame(const uint8_t* frame){
+    if (!ssd1306_FrameAcquire(false)) {
+        return false;
+    }
+    // The frame is laid out from GDDRAM row 0, the ring start line is restored by the next update.
+    if (scroll_offset != 0 || start_line_queued) {
+        if (!ssd1306_SetStartLine(0)) {
+            ssd1306_FrameRelease();
+            return false;
+        }
+        start_line_queued = false;
+        start_line_pending = scroll_offset != 0;
+    }
+    if (!ssd1306_SetWindow(0, SSD1306_WIDTH - 1, 0, SSD1306_PAGES - 1)) {
+        ssd1306_FrameRelease();
+        return false;
+    }
+    bool started = ssd1306_platform_start_data_dma(frame, SSD1306_BUFFER_SIZE);
+    // GDDRAM no longer mirrors the frame buffer. The frame belongs to the caller, who keeps it until the transfer is
+    // done; later flushes on this panel wait for its bus.
+    ssd1306_MarkAllDirty();
+    ssd1306_FrameRelease();
+    return started;
+}
+
+bool ssd1306_FlushPoll(void){
+    if (!ssd1306_FrameAcquire(false)) {
+        return false;
+    }
+    bool done = ssd1306_FlushStartLine();
+    ssd1306_FrameRelease();
+    return done;
+}
+
+bool ssd1306_UpdateDirty(void){
+    if (!ssd1306_FrameAcquire(true)) {
+        return false;
+    }
+    ssd1306_FlushStartLine();
+    ssd1306_RotateDirty();
+    ssd1306_ComposeDirty();
+
+    uint8_t page = 0;
+    while (page < SSD1306_PAGES) {
+        if (dirty_x0[page] > dirty_x1[page]) {
+            page++;
+            continue;
+        }
+        // Consecutive dirty pages share one address window spanning the union of their columns.
+        uint8_t first = page;
+        uint8_t x0 = dirty_x0[page];
+        uint8_t x1 = dirty_x1[page];
+        while (page + 1 < SSD1306_PAGES && dirty_x0[page + 1] <= dirty_x1[page + 1]) {
+            page++;
+            if (dirty_x0[page] < x0) x0 = dirty_x0[page];
+            if (dirty_x1[page] > x1) x1 = dirty_x1[page];
+        }
+        uint8_t last = page;
+
+        if (!ssd1306_SetWindow(x0, x1, first, last)) {
+            ssd1306_FrameRelease();
+            return false;
+        }
+        bool sent;
+        if (x0 == 0 && x1 == SSD1306_WIDTH - 1) {
+            // Full width pages are contiguous in the buffer.
+            sent = ssd1306_WriteData(&buffer[first * SSD1306_WIDTH], (uint16_t)(last - first + 1) * SSD1306_WIDTH);
+        } else {
+            sent = true;
+            for (uint8_t p = first; p <= last && sent; p++) {
+                sent = ssd1306_WriteData(&buffer[p * SSD1306_WIDTH + x0], (uint16_t)(x1 - x0 + 1));
+            }
+        }
+        if (!sent) {
+            ssd1306_FrameRelease();
+            return false;
+        }
+        for (uint8_t p = first; p <= last; p++) {
+            dirty_x0[p] = 0xFF;
+            dirty_x1[p] = 0;
+        }
+        page++;
+    }
+
+    ssd1306_QueueStartLine();
+    ssd1306_FlushStartLine();
+    ssd1306_FrameRelease();
+    return true;
 }
 
 bool ssd1306_SetMemoryAddressingMode(uint8_t mode){
@@ -344,15 +820,234 @@ bool ssd1306_SetContrast(uint8_t contrast) {
 }
 
 // Internal Helper
+
+static inline bool ssd1306_Redirected(void) {
+    return surface || target || portrait || layer;
+}
+
+static inline int16_t ssd1306_TargetWidth(void) {
+    if (surface)
+        return (int16_t)surface->width;
+    if (target)
+        return (int16_t)(target->tiles_x * SSD1306_WIDTH);
+    return portrait ? SSD1306_PORTRAIT_WIDTH : SSD1306_WIDTH;
+}
+
+static inline int16_t ssd1306_TargetHeight(void) {
+    if (surface)
+        return (int16_t)surface->height;
+    if (target)
+        return (int16_t)(target->tiles_y * SSD1306_HEIGHT);
+    return portrait ? SSD1306_WIDTH : SSD1306_HEIGHT;
+}
+
+/**
+ * @brief  Locates the canvas byte holding row y of column x, the point must be on the canvas.
+ * @retval Offset in the canvas buffer, the tile is offset / SSD1306_BUFFER_SIZE.
+ */
+static inline uint32_t ssd1306_CanvasOffset(int16_t x, int16_t y) {
+    uint16_t tile = (uint16_t)((y / SSD1306_HEIGHT) * target->tiles_x + x / SSD1306_WIDTH);
+    return (uint32_t)tile * SSD1306_BUFFER_SIZE + ((y % SSD1306_HEIGHT) >> 3) * SSD1306_WIDTH + x % SSD1306_WIDTH;
+}
+
+/**
+ * @brief  Locates the byte holding row y of column x on the surface, the canvas, the selected layer or the portrait
+ *         buffer, the point must be on it.
+ * @param  mark true to record the byte as modified.
+ */
+static inline uint8_t* ssd1306_SurfaceByte(int16_t x, int16_t y, bool mark) {
+    if (surface)
+        return &surface->buffer[(uint32_t)(y >> 3) * surface->stride + x];
+    if (target) {
+        uint32_t offset = ssd1306_CanvasOffset(x, y);
+        if (mark)
+            target->dirty_tiles |= (uint16_t)(1u << (offset / SSD1306_BUFFER_SIZE));
+        return &target->buffer[offset];
+    }
+    uint8_t page = (uint8_t)(y >> 3);
+    if (layer) {
+        if (mark)
+            ssd1306_MarkLayerDirty(page, (uint8_t)x);
+        return &layer[page * SSD1306_WIDTH + x];
+    }
+    if (mark)
+        ssd1306_MarkPortraitDirty(page, (uint8_t)x);
+    return &portrait[page * SSD1306_PORTRAIT_WIDTH + x];
+}
+
+/**
+ * @brief  Writes 8 rows of a surface, canvas, layer or portrait column from y, clipped like ssd1306_PutColumn().
+ * @param  toggle true to invert the rows set in mask instead of replacing them with bits.
+ */
+static void ssd1306_SurfaceColumn(int16_t x, int16_t y, uint8_t bits, uint8_t mask, bool toggle) {
+    int16_t height = ssd1306_TargetHeight();
+    if (x < 0 || x >= ssd1306_TargetWidth() || y <= -8 || y >= height)
+        return;
+    if (y < 0) {
+        bits >>= -y;
+        mask >>= -y;
+        y = 0;
+    } else if (y > height - 8) {
+        mask &= (uint8_t)(0xFF >> (y - (height - 8)));
+    }
+    if (!mask)
+        return;
+    SSD1306_COUNT(column_writes);
+
+    // Surfaces and canvases are not rings, rows past the page boundary go to the page below, possibly in the tile below.
+    uint8_t shift = y & 7;
+    uint16_t m = (uint16_t)(mask << shift);
+    uint16_t b = (uint16_t)(bits << shift);
+    for (y -= shift; m; y += 8, m >>= 8, b >>= 8) {
+        uint8_t mm = (uint8_t)m;
+        if (!mm)
+            continue;
+        uint8_t* dst = ssd1306_SurfaceByte(x, y, true);
+        *dst = toggle ? (uint8_t)(*dst ^ (b & mm)) : (uint8_t)((*dst & ~mm) | (b & mm));
+    }
+}
+
 static inline void ssd1306_SetPixel(int16_t x, int16_t y, bool color) {
+    if (ssd1306_Redirected()) {
+        if (x < 0 || x >= ssd1306_TargetWidth() || y < 0 || y >= ssd1306_TargetHeight())
+            return;
+        uint8_t* dst = ssd1306_SurfaceByte(x, y, true);
+        if (color)
+            *dst |= (uint8_t)(1 << (y & 7));
+        else
+            *dst &= (uint8_t)~(1 << (y & 7));
+        SSD1306_COUNT(pixel_writes);
+        return;
+    }
     if (x < 0 || x >= SSD1306_WIDTH || y < 0 || y >= SSD1306_HEIGHT)
         return;
-    uint16_t byteIndex = x + (y / 8) * SSD1306_WIDTH;
-    uint8_t bitMask = 1 << (y % 8);
+    uint8_t row = (uint8_t)(y + scroll_offset) & (SSD1306_HEIGHT - 1);
+    uint8_t page = row >> 3;
+    uint16_t byteIndex = x + page * SSD1306_WIDTH;
+    uint8_t bitMask = 1 << (row & 7);
     if (color)
         buffer[byteIndex] |= bitMask;
     else
         buffer[byteIndex] &= ~bitMask;
+    ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)x);
+    SSD1306_COUNT(pixel_writes);
+}
+
+static inline void ssd1306_PutColumn(int16_t x, int16_t y, uint8_t bits, uint8_t mask) {
+    if (ssd1306_Redirected()) {
+        ssd1306_SurfaceColumn(x, y, bits, mask, false);
+        return;
+    }
+    if (x < 0 || x >= SSD1306_WIDTH || y <= -8 || y >= SSD1306_HEIGHT)
+        return;
+    // Clip the rows that fall outside the screen so they do not wrap around the ring.
+    if (y < 0) {
+        bits >>= -y;
+        mask >>= -y;
+        y = 0;
+    } else if (y > SSD1306_HEIGHT - 8) {
+        mask &= (uint8_t)(0xFF >> (y - (SSD1306_HEIGHT - 8)));
+    }
+    if (!mask)
+        return;
+    SSD1306_COUNT(column_writes);
+
+    uint8_t row = (uint8_t)(y + scroll_offset) & (SSD1306_HEIGHT - 1);
+    uint8_t page = row >> 3;
+    uint8_t shift = row & 7;
+    uint8_t m = (uint8_t)(mask << shift);
+    if (m) {
+        uint8_t* dst = &buffer[page * SSD1306_WIDTH + x];
+        *dst = (uint8_t)((*dst & ~m) | ((bits << shift) & m));
+        ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)x);
+    }
+    // Rows below the page boundary continue in the next page of the ring.
+    if (shift) {
+        m = (uint8_t)(mask >> (8 - shift));
+        if (m) {
+            page = (page + 1) & (SSD1306_PAGES - 1);
+            uint8_t* dst = &buffer[page * SSD1306_WIDTH + x];
+            *dst = (uint8_t)((*dst & ~m) | ((bits >> (8 - shift)) & m));
+            ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)x);
+        }
+    }
+}
+
+bool ssd1306_WriteColumn(int16_t x, int16_t y, uint8_t bits, uint8_t mask) {
+    ssd1306_PutColumn(x, y, bits, mask);
+    return true;
+}
+
+bool ssd1306_XorColumn(int16_t x, int16_t y, uint8_t bits) {
+    if (ssd1306_Redirected()) {
+        if (x < 0 || x >= ssd1306_TargetWidth() || y <= -8 || y >= ssd1306_TargetHeight())
+            return false;
+        ssd1306_SurfaceColumn(x, y, bits, bits, true);
+        return true;
+    }
+    if (x < 0 || x >= SSD1306_WIDTH || y <= -8 || y >= SSD1306_HEIGHT)
+        return false;
+    if (y < 0) {
+        bits >>= -y;
+        y = 0;
+    } else if (y > SSD1306_HEIGHT - 8) {
+        bits &= (uint8_t)(0xFF >> (y - (SSD1306_HEIGHT - 8)));
+    }
+    if (!bits)
+        return true;
+    SSD1306_COUNT(column_writes);
+
+    uint8_t row = (uint8_t)(y + scroll_offset) & (SSD1306_HEIGHT - 1);
+    uint8_t page = row >> 3;
+    uint8_t shift = row & 7;
+    uint8_t b = (uint8_t)(bits << shift);
+    if (b) {
+        buffer[page * SSD1306_WIDTH + x] ^= b;
+        ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)x);
+    }
+    if (shift) {
+        b = (uint8_t)(bits >> (8 - shift));
+        if (b) {
+            page = (page + 1) & (SSD1306_PAGES - 1);
+            buffer[page * SSD1306_WIDTH + x] ^= b;
+            ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)x);
+        }
+    }
+    return true;
+}
+
+uint8_t ssd1306_ReadColumn(int16_t x, int16_t y) {
+    if (ssd1306_Redirected()) {
+        int16_t height = ssd1306_TargetHeight();
+        if (x < 0 || x >= ssd1306_TargetWidth() || y <= -8 || y >= height)
+            return 0;
+        // Rows above the canvas read as off, the column is read from the first page it overlaps.
+        int16_t top = y < 0 ? 0 : y;
+        uint8_t shift = top & 7;
+        uint16_t bits = *ssd1306_SurfaceByte(x, top, false);
+        if (shift && top - shift + 8 < height)
+            bits |= (uint16_t)(*ssd1306_SurfaceByte(x, top - shift + 8, false) << 8);
+        bits >>= shift;
+        return y < 0 ? (uint8_t)(bits << -y) : (uint8_t)bits;
+    }
+    if (x < 0 || x >= SSD1306_WIDTH || y <= -8 || y >= SSD1306_HEIGHT)
+        return 0;
+    // Read 8 rows from y, rows outside the screen read as off.
+    uint8_t valid = 0xFF;
+    if (y < 0)
+        valid = (uint8_t)(0xFF << -y);
+    else if (y > SSD1306_HEIGHT - 8)
+        valid = (uint8_t)(0xFF >> (y - (SSD1306_HEIGHT - 8)));
+
+    uint8_t row = (uint8_t)(y + scroll_offset) & (SSD1306_HEIGHT - 1);
+    uint8_t page = row >> 3;
+    uint8_t shift = row & 7;
+    uint8_t bits = (uint8_t)(buffer[page * SSD1306_WIDTH + x] >> shift);
+    if (shift) {
+        page = (page + 1) & (SSD1306_PAGES - 1);
+        bits |= (uint8_t)(buffer[page * SSD1306_WIDTH + x] << (8 - shift));
+    }
+    return bits & valid;
 }
 
 bool ssd1306_DrawPixel(uint8_t x, uint8_t y, bool color) {
@@ -361,12 +1056,16 @@ bool ssd1306_DrawPixel(uint8_t x, uint8_t y, bool color) {
 }
 
 bool ssd1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool color) {
+    return ssd1306_DrawLineStyle(x0, y0, x1, y1, thickness, color, SSD1306_LINE_SOLID);
+}
+
+bool ssd1306_DrawLineStyle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool color, uint8_t style) {
     int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
     int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int16_t err = dx + dy, e2;
 
-    while (1) {
-        for (uint8_t t = 0; t < thickness; ++t)
+    for (uint8_t step = 0; ; step = (uint8_t)((step + 1) & 7)) {
+        for (uint8_t t = 0; t < thickness && (style >> step) & 1; ++t)
             ssd1306_SetPixel(x0, y0 + t, color);
         if (x0 == x1 && y0 == y1) break;
         e2 = 2 * err;
@@ -431,56 +1130,550 @@ bool ssd1306_DrawPoly(int16_t* x, int16_t* y, uint8_t vertex_count, uint8_t thic
     return true;
 }
 
+/**
+ * @brief  Bounding box of a polygon clipped to the target, only points inside it can be in the polygon.
+ * @retval false if the polygon has fewer than 3 vertices.
+ */
+static bool ssd1306_PolyBounds(const int16_t* x, const int16_t* y, uint8_t vertex_count, int16_t* x0, int16_t* y0, int16_t* x1, int16_t* y1) {
+    if (vertex_count < 3)
+        return false;
+    *x0 = *x1 = x[0];
+    *y0 = *y1 = y[0];
+    for (uint8_t i = 1; i < vertex_count; i++) {
+        if (x[i] < *x0) *x0 = x[i];
+        if (x[i] > *x1) *x1 = x[i];
+        if (y[i] < *y0) *y0 = y[i];
+        if (y[i] > *y1) *y1 = y[i];
+    }
+    if (*x0 < 0) *x0 = 0;
+    if (*y0 < 0) *y0 = 0;
+    if (*x1 >= ssd1306_TargetWidth()) *x1 = ssd1306_TargetWidth() - 1;
+    if (*y1 >= ssd1306_TargetHeight()) *y1 = ssd1306_TargetHeight() - 1;
+    return true;
+}
+
 bool ssd1306_FillPoly(int16_t* x, int16_t* y, uint8_t vertex_count, bool color) {
-    uint8_t px[SSD1306_WIDTH * SSD1306_HEIGHT];
-    uint8_t py[SSD1306_WIDTH * SSD1306_HEIGHT];
-    bool results[SSD1306_WIDTH * SSD1306_HEIGHT];
-    uint16_t count = 0;
-    for (uint8_t i = 0; i < SSD1306_WIDTH; i++) {
-        for (uint8_t j = 0; j < SSD1306_HEIGHT; j++) {
-            px[count] = i;
-            py[count] = j;
-            count++;
+    int16_t x0, y0, x1, y1;
+    if (!ssd1306_PolyBounds(x, y, vertex_count, &x0, &y0, &x1, &y1))
+        return false;
+
+    // Rows are tested in spans of up to one panel width.
+    int16_t px[SSD1306_WIDTH];
+    int16_t py[SSD1306_WIDTH];
+    bool results[SSD1306_WIDTH];
+    for (int16_t j = y0; j <= y1; j++) {
+        for (int16_t i0 = x0; i0 <= x1; i0 += SSD1306_WIDTH) {
+            uint16_t count = (uint16_t)(x1 - i0 + 1 < SSD1306_WIDTH ? x1 - i0 + 1 : SSD1306_WIDTH);
+            for (uint16_t i = 0; i < count; i++) {
+                px[i] = (int16_t)(i0 + i);
+                py[i] = j;
+            }
+            InPoly(px, py, count, x, y, vertex_count, results);
+            for (uint16_t i = 0; i < count; i++) {
+                if (results[i])
+                    ssd1306_SetPixel(px[i], py[i], color);
+            }
         }
     }
-    InPoly(px, py, count, x, y, vertex_count, results);
-    for (uint16_t i = 0; i < count; i++) {
-        if (results[i])
-            ssd1306_SetPixel(px[i], py[i], color);
+    return true;
+}
+
+/**
+ * @brief  Writes rows y0 to y1 of column x from a column byte repeating every 8 rows, as whole bytes aligned to 8 rows
+ *         so no bit shifting is needed.
+ */
+static void ssd1306_FillSpan(int16_t x, int16_t y0, int16_t y1, uint8_t column) {
+    if (x < 0 || x >= ssd1306_TargetWidth())
+        return;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= ssd1306_TargetHeight()) y1 = ssd1306_TargetHeight() - 1;
+    for (int16_t top = (int16_t)(y0 & ~7); top <= y1; top += 8) {
+        uint8_t mask = 0xFF;
+        if (top < y0) mask &= (uint8_t)(0xFF << (y0 - top));
+        if (top + 7 > y1) mask &= (uint8_t)(0xFF >> (top + 7 - y1));
+        ssd1306_PutColumn(x, top, column, mask);
+    }
+}
+
+static inline void ssd1306_PatternSpan(int16_t x, int16_t y0, int16_t y1, const ssd1306_pattern_t* pattern) {
+    ssd1306_FillSpan(x, y0, y1, pattern->columns[x & 7]);
+}
+
+bool ssd1306_FillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h, const ssd1306_pattern_t* pattern) {
+    if (!pattern || w <= 0 || h <= 0)
+        return false;
+    for (int16_t i = 0; i < w; i++) {
+        ssd1306_PatternSpan(x + i, y, y + h - 1, pattern);
     }
     return true;
 }
 
-bool ssd1306_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int w, int h, bool color) {
-    for (int16_t j = 0; j < h; j++) {
-        for (int16_t i = 0; i < w; i++) {
-            if (bitmap[i + (j / 8) * w] & (1 << (j % 8))) {
-                ssd1306_SetPixel(x + i, y + j, color);
+bool ssd1306_FillCirclePattern(int16_t x0, int16_t y0, uint16_t r, const ssd1306_pattern_t* pattern) {
+    if (!pattern)
+        return false;
+    // Column dx holds the rows with dx * dx + dy * dy <= r * r, the same pixels as ssd1306_FillCircle().
+    int32_t rr = (int32_t)r * r;
+    int16_t h = (int16_t)r;
+    for (int16_t dx = 0; dx <= (int16_t)r; dx++) {
+        while ((int32_t)dx * dx + (int32_t)h * h > rr)
+            h--;
+        ssd1306_PatternSpan(x0 + dx, y0 - h, y0 + h, pattern);
+        if (dx)
+            ssd1306_PatternSpan(x0 - dx, y0 - h, y0 + h, pattern);
+    }
+    return true;
+}
+
+bool ssd1306_FillPolyPattern(int16_t* x, int16_t* y, uint8_t vertex_count, const ssd1306_pattern_t* pattern) {
+    int16_t x0, y0, x1, y1;
+    if (!pattern || !ssd1306_PolyBounds(x, y, vertex_count, &x0, &y0, &x1, &y1))
+        return false;
+
+    // Columns are tested in runs of up to 128 rows starting on a multiple of 8, then written 8 rows at a time.
+    int16_t px[SSD1306_WIDTH];
+    int16_t py[SSD1306_WIDTH];
+    bool results[SSD1306_WIDTH];
+    for (int16_t i = x0; i <= x1; i++) {
+        uint8_t column = pattern->columns[i & 7];
+        for (int16_t top = (int16_t)(y0 & ~7); top <= y1; top += SSD1306_WIDTH) {
+            int16_t first = top < y0 ? y0 : top;
+            int16_t last = top + SSD1306_WIDTH - 1 < y1 ? top + SSD1306_WIDTH - 1 : y1;
+            uint16_t count = (uint16_t)(last - first + 1);
+            for (uint16_t k = 0; k < count; k++) {
+                px[k] = i;
+                py[k] = (int16_t)(first + k);
+            }
+            InPoly(px, py, count, x, y, vertex_count, results);
+            for (int16_t row = top; row <= last; row += 8) {
+                uint8_t mask = 0;
+                for (uint8_t b = 0; b < 8; b++) {
+                    int16_t j = row + b;
+                    if (j >= first && j <= last && results[j - first])
+                        mask |= (uint8_t)(1 << b);
+                }
+                if (mask)
+                    ssd1306_PutColumn(i, row, column, mask);
             }
         }
     }
     return true;
 }
 
-bool ssd1306_WriteChar(int16_t x, int16_t y, char ch, FontDef font, bool color) {
-    uint16_t idx = (ch - 32) * font.height;
-    for (uint8_t row = 0; row < font.height; row++) {
-        uint8_t line = font.data[idx + row];
-        for (uint8_t col = 0; col < font.width; col++) {
-            if (line & (1 << col)) {
-                ssd1306_SetPixel(x + col, y + row, color);
+/**
+ * @brief  Reads 8 rows of column x from y with the pixels of the color being replaced as 1 bits.
+ */
+static inline uint8_t ssd1306_FloodBits(int16_t x, int16_t y, bool old) {
+    uint8_t bits = ssd1306_ReadColumn(x, y);
+    return old ? bits : (uint8_t)~bits;
+}
+
+/**
+ * @brief  Extends a run of the replaced color in column x from row y up and down, 8 rows per read.
+ */
+static void ssd1306_FloodRun(int16_t x, int16_t y, bool old, int16_t height, int16_t* top, int16_t* bottom) {
+    int16_t t = y;
+    while (t > 0) {
+        // Rows t - 8 to t - 1, the run continues through the leading ones from the MSB.
+        uint8_t bits = ssd1306_FloodBits(x, t - 8, old);
+        int16_t n = bits == 0xFF ? 8 : (int16_t)__builtin_clz((uint32_t)(uint8_t)~bits << 24);
+        if (n > t) n = t;
+        t -= n;
+        if (n < 8) break;
+    }
+    int16_t b = y;
+    while (b < height - 1) {
+        uint8_t bits = ssd1306_FloodBits(x, b + 1, old);
+        int16_t n = bits == 0xFF ? 8 : (int16_t)__builtin_ctz((uint32_t)(uint8_t)~bits);
+        if (n > height - 1 - b) n = height - 1 - b;
+        b += n;
+        if (n < 8) break;
+    }
+    *top = t;
+    *bottom = b;
+}
+
+bool ssd1306_FloodFill(int16_t x, int16_t y, bool color, ssd1306_flood_span_t* stack, uint16_t stack_size, ssd1306_area_t* bounds) {
+    static ssd1306_flood_span_t default_stack[SSD1306_FLOOD_STACK];
+    const int16_t width = ssd1306_TargetWidth();
+    const int16_t height = ssd1306_TargetHeight();
+    int16_t x0 = width, x1 = -1, y0 = height, y1 = -1;
+    if (bounds)
+        bounds->x = bounds->y = bounds->w = bounds->h = 0;
+    if (x < 0 || x >= width || y < 0 || y >= height)
+        return false;
+    if (!stack) {
+        stack = default_stack;
+        stack_size = SSD1306_FLOOD_STACK;
+    }
+    bool old = ssd1306_ReadColumn(x, y) & 1;
+    if (old == color)
+        return true;
+    uint8_t column = color ? 0xFF : 0x00;
+
+    // Vertical runs are the scanlines, they are read and written in page bytes. An entry asks for the runs of the
+    // replaced color meeting rows y0 to y1 of column x, reached from column x - dir. A run that reaches past those
+    // rows leaks back into column x - dir beyond the parent run, only that part is searched again.
+    bool complete = true;
+    uint16_t depth = 0;
+    int16_t top, bottom;
+    ssd1306_FloodRun(x, y, old, height, &top, &bottom);
+    ssd1306_FillSpan(x, top, bottom, column);
+    x0 = x1 = x;
+    y0 = top;
+    y1 = bottom;
+    for (int8_t dir = -1; dir <= 1; dir += 2) {
+        if (x + dir < 0 || x + dir >= width)
+            continue;
+        if (depth == stack_size) { complete = false; break; }
+        stack[depth++] = (ssd1306_flood_span_t){ (int16_t)(x + dir), top, bottom, dir };
+    }
+
+    while (depth) {
+        ssd1306_flood_span_t span = stack[--depth];
+        int16_t row = span.y0;
+        while (row <= span.y1) {
+            // Skip to the next pixel of the replaced color, 8 rows per read.
+            uint8_t bits = ssd1306_FloodBits(span.x, row, old);
+            if (!bits) {
+                row += 8;
+                continue;
+            }
+            row += (int16_t)__builtin_ctz(bits);
+            if (row > span.y1)
+                break;
+            ssd1306_FloodRun(span.x, row, old, height, &top, &bottom);
+            ssd1306_FillSpan(span.x, top, bottom, column);
+            if (span.x < x0) x0 = span.x;
+            if (span.x > x1) x1 = span.x;
+            if (top < y0) y0 = top;
+            if (bottom > y1) y1 = bottom;
+
+            ssd1306_flood_span_t next[3];
+            uint8_t count = 0;
+            int16_t ahead = (int16_t)(span.x + span.dir);
+            int16_t back = (int16_t)(span.x - span.dir);
+            if (ahead >= 0 && ahead < width)
+                next[count++] = (ssd1306_flood_span_t){ ahead, top, bottom, span.dir };
+            if (top < span.y0 && back >= 0 && back < width)
+                next[count++] = (ssd1306_flood_span_t){ back, top, (int16_t)(span.y0 - 1), (int8_t)-span.dir };
+            if (bottom > span.y1 && back >= 0 && back < width)
+                next[count++] = (ssd1306_flood_span_t){ back, (int16_t)(span.y1 + 1), bottom, (int8_t)-span.dir };
+            for (uint8_t i = 0; i < count; i++) {
+                if (depth == stack_size) {
+                    complete = false;
+                    break;
+                }
+                stack[depth++] = next[i];
+            }
+            row = (int16_t)(bottom + 1);
+        }
+    }
+
+    if (bounds) {
+        bounds->x = x0;
+        bounds->y = y0;
+        bounds->w = (int16_t)(x1 - x0 + 1);
+        bounds->h = (int16_t)(y1 - y0 + 1);
+    }
+    return complete;
+}
+
+// Quarter wave of sin() in Q14, one entry per degree.
+static const uint16_t sin_q14[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384
+};
+
+int16_t ssd1306_Sin(int16_t angle) {
+    int16_t a = (int16_t)(angle % 360);
+    if (a < 0) a += 360;
+    if (a <= 90) return (int16_t)sin_q14[a];
+    if (a <= 180) return (int16_t)sin_q14[180 - a];
+    if (a <= 270) return (int16_t)-(int16_t)sin_q14[a - 180];
+    return (int16_t)-(int16_t)sin_q14[360 - a];
+}
+
+int16_t ssd1306_Cos(int16_t angle) {
+    return ssd1306_Sin((int16_t)(angle % 360 + 90));
+}
+
+void ssd1306_Polar(int16_t x0, int16_t y0, int16_t r, int16_t angle, int16_t* x, int16_t* y) {
+    // Rounded to the nearest pixel, rows grow downwards so the sine is subtracted.
+    *x = (int16_t)(x0 + (((int32_t)r * ssd1306_Cos(angle) + 8192) >> 14));
+    *y = (int16_t)(y0 - (((int32_t)r * ssd1306_Sin(angle) + 8192) >> 14));
+}
+
+/**
+ * @brief Angular range of an arc, the start and end directions in Q14 with y pointing up.
+ */
+typedef struct {
+    int32_t sx, sy, ex, ey;
+    uint8_t kind;   // 0 full turn, 1 up to half a turn, 2 more than half a turn
+} ssd1306_sweep_t;
+
+static void ssd1306_SweepInit(int16_t start, int16_t end, ssd1306_sweep_t* sweep) {
+    int32_t turn = (int32_t)end - start;
+    sweep->sx = ssd1306_Cos(start);
+    sweep->sy = ssd1306_Sin(start);
+    sweep->ex = ssd1306_Cos(end);
+    sweep->ey = ssd1306_Sin(end);
+    if (turn >= 360) {
+        sweep->kind = 0;
+        return;
+    }
+    turn %= 360;
+    if (turn < 0) turn += 360;
+    sweep->kind = turn <= 180 ? 1 : 2;
+}
+
+/**
+ * @brief  Tests an offset from the arc center against the sweep with two cross products, no angle is computed.
+ */
+static inline bool ssd1306_InSweep(const ssd1306_sweep_t* sweep, int32_t dx, int32_t dy) {
+    if (sweep->kind == 0)
+        return true;
+    int32_t py = -dy;
+    int32_t from = sweep->sx * py - sweep->sy * dx; // >= 0 when counter-clockwise of the start
+    int32_t to = dx * sweep->ey - py * sweep->ex;   // >= 0 when clockwise of the end
+    if (sweep->kind == 1)
+        return from >= 0 && to >= 0;
+    // More than half a turn is everything outside the strictly smaller sector from the end round to the start.
+    return from >= 0 || to >= 0;
+}
+
+/**
+ * @brief  Sets the pixels within the sweep with inner < dx * dx + dy * dy <= r * r, in byte wide column writes.
+ * @param  inner Squared inner radius, -1 to include the center.
+ */
+static void ssd1306_FillSector(int16_t x0, int16_t y0, uint16_t r, int32_t inner, const ssd1306_sweep_t* sweep, bool color) {
+    const int16_t width = ssd1306_TargetWidth();
+    const int16_t height = ssd1306_TargetHeight();
+    int32_t outer = (int32_t)r * r;
+    int16_t h = (int16_t)r;
+    for (int16_t dx = 0; dx <= (int16_t)r; dx++) {
+        while ((int32_t)dx * dx + (int32_t)h * h > outer)
+            h--;
+        for (int8_t side = 1; side >= -1; side -= 2) {
+            int16_t cx = (int16_t)(dx * side);
+            int16_t x = x0 + cx;
+            if ((side < 0 && dx == 0) || x < 0 || x >= width)
+                continue;
+            int16_t first = y0 - h < 0 ? 0 : y0 - h;
+            int16_t last = y0 + h >= height ? height - 1 : y0 + h;
+            for (int16_t top = (int16_t)(first & ~7); top <= last; top += 8) {
+                uint8_t mask = 0;
+                for (uint8_t b = 0; b < 8; b++) {
+                    int16_t y = top + b;
+                    int32_t dy = y - y0;
+                    if (y >= first && y <= last && (int32_t)cx * cx + dy * dy > inner && ssd1306_InSweep(sweep, cx, dy))
+                        mask |= (uint8_t)(1 << b);
+                }
+                if (mask)
+                    ssd1306_PutColumn(x, top, color ? 0xFF : 0x00, mask);
             }
         }
     }
+}
+
+bool ssd1306_DrawArc(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, uint8_t thickness, bool color) {
+    if (thickness == 0)
+        return false;
+    ssd1306_sweep_t sweep;
+    ssd1306_SweepInit(start, end, &sweep);
+    if (thickness > 1) {
+        ssd1306_FillSector(x0, y0, r, r >= thickness ? (int32_t)(r - thickness) * (r - thickness) : -1, &sweep, color);
+        return true;
+    }
+    // The pixels of ssd1306_DrawCircle(), each kept if it is within the sweep.
+    int16_t f = 1 - r;
+    int16_t dx = 1, dy = -2 * r;
+    int16_t x = 0, y = r;
+    while (x <= y) {
+        const int16_t points[8][2] = { { x, y }, { -x, y }, { x, -y }, { -x, -y }, { y, x }, { -y, x }, { y, -x }, { -y, -x } };
+        for (uint8_t i = 0; i < 8; i++) {
+            if (ssd1306_InSweep(&sweep, points[i][0], points[i][1]))
+                ssd1306_SetPixel(x0 + points[i][0], y0 + points[i][1], color);
+        }
+        if (f >= 0) { y--; dy += 2; f += dy; }
+        x++; dx += 2; f += dx;
+    }
+    return true;
+}
+
+bool ssd1306_FillPie(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, bool color) {
+    ssd1306_sweep_t sweep;
+    ssd1306_SweepInit(start, end, &sweep);
+    ssd1306_FillSector(x0, y0, r, -1, &sweep, color);
+    return true;
+}
+
+bool ssd1306_DrawNeedle(int16_t x0, int16_t y0, int16_t r0, int16_t r1, int16_t angle, uint8_t width, bool color) {
+    int16_t x[3], y[3];
+    ssd1306_Polar(x0, y0, r1, angle, &x[0], &y[0]);
+    if (width <= 1) {
+        int16_t bx, by;
+        ssd1306_Polar(x0, y0, r0, angle, &bx, &by);
+        return ssd1306_DrawLine(bx, by, x[0], y[0], 1, color);
+    }
+    // A triangle from the base at r0, width across, to the tip at r1.
+    int16_t bx, by;
+    ssd1306_Polar(x0, y0, r0, angle, &bx, &by);
+    ssd1306_Polar(bx, by, (int16_t)(width / 2), (int16_t)(angle + 90), &x[1], &y[1]);
+    ssd1306_Polar(bx, by, (int16_t)(width / 2), (int16_t)(angle - 90), &x[2], &y[2]);
+    return ssd1306_FillPoly(x, y, 3, color);
+}
+
+/**
+ * @brief  Corners of a w by h rectangle turned around its center, in drawing order.
+ */
+static void ssd1306_RotatedCorners(int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t angle, int16_t* x, int16_t* y) {
+    static const int8_t signs[4][2] = { { -1, 1 }, { 1, 1 }, { 1, -1 }, { -1, -1 } };
+    int32_t c = ssd1306_Cos(angle);
+    int32_t s = ssd1306_Sin(angle);
+    // Twice the half extents, so the corners of even sizes keep their half pixel until the final rounding.
+    for (uint8_t i = 0; i < 4; i++) {
+        int32_t ex = signs[i][0] * (int32_t)(w - 1);
+        int32_t ey = signs[i][1] * (int32_t)(h - 1);
+        x[i] = (int16_t)(cx + ((ex * c - ey * s + (1 << 14)) >> 15));
+        y[i] = (int16_t)(cy - ((ex * s + ey * c + (1 << 14)) >> 15));
+    }
+}
+
+bool ssd1306_DrawRectRotated(int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t angle, uint8_t thickness, bool color) {
+    if (w <= 0 || h <= 0)
+        return false;
+    int16_t x[4], y[4];
+    ssd1306_RotatedCorners(cx, cy, w, h, angle, x, y);
+    return ssd1306_DrawPoly(x, y, 4, thickness, color);
+}
+
+bool ssd1306_FillRectRotated(int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t angle, bool color) {
+    if (w <= 0 || h <= 0)
+        return false;
+    int16_t x[4], y[4];
+    ssd1306_RotatedCorners(cx, cy, w, h, angle, x, y);
+    return ssd1306_FillPoly(x, y, 4, color);
+}
+
+bool ssd1306_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int w, int h, bool color) {
+    // The bitmap is page aligned like the frame buffer, every 8 rows of a column are one masked column write.
+    for (int16_t band = 0; band < h; band += 8) {
+        uint8_t rows = (uint8_t)(h - band < 8 ? h - band : 8);
+        uint8_t mask = (uint8_t)(0xFF >> (8 - rows));
+        const uint8_t* src = &bitmap[(band / 8) * w];
+        for (int16_t i = 0; i < w; i++) {
+            uint8_t bits = (uint8_t)(src[i] & mask);
+            if (bits)
+                ssd1306_PutColumn(x + i, y + band, color ? bits : 0, bits);
+        }
+    }
+    return true;
+}
+
+bool ssd1306_InitSurface(ssd1306_surface_t* image, uint8_t* pixels, uint16_t width, uint16_t height, uint16_t stride) {
+    if (!image || !pixels || width == 0 || height == 0 || stride < width)
+        return false;
+    image->buffer = pixels;
+    image->width = width;
+    image->height = height;
+    image->stride = stride;
+    for (uint16_t page = 0; page < (height + 7) / 8; page++)
+        memset(&pixels[(uint32_t)page * stride], 0, width);
+    return true;
+}
+
+bool ssd1306_SetSurface(ssd1306_surface_t* image) {
+    if (image && (!image->buffer || image->width == 0 || image->height == 0 || image->stride < image->width))
+        return false;
+    surface = image;
+    return true;
+}
+
+bool ssd1306_Blit(const ssd1306_surface_t* src, int16_t sx, int16_t sy, int16_t w, int16_t h, int16_t x, int16_t y) {
+    if (!src || !src->buffer || src == surface)
+        return false;
+    // Clip the rectangle to the source, then its columns to the target. Rows are clipped by the column writes.
+    if (sx < 0) { w += sx; x -= sx; sx = 0; }
+    if (sy < 0) { h += sy; y -= sy; sy = 0; }
+    if (sx + w > (int16_t)src->width) w = (int16_t)(src->width - sx);
+    if (sy + h > (int16_t)src->height) h = (int16_t)(src->height - sy);
+    if (x < 0) { w += x; sx -= x; x = 0; }
+    const int16_t max_x = ssd1306_TargetWidth();
+    const int16_t max_y = ssd1306_TargetHeight();
+    if (x + w > max_x) w = max_x - x;
+    if (w <= 0 || h <= 0 || y >= max_y || y + h <= 0)
+        return false;
+
+    // Onto the frame buffer or a layer, whole source pages landing on whole pages are copied as they are.
+    bool direct = !surface && !target && !portrait;
+    uint8_t* frame = layer ? layer : buffer;
+    uint8_t ring = layer ? 0 : scroll_offset;
+    for (int16_t band = 0; band < h; band += 8) {
+        int16_t row = sy + band;
+        int16_t dy = y + band;
+        uint8_t rows = (uint8_t)(h - band < 8 ? h - band : 8);
+        if (dy + rows <= 0 || dy >= max_y)
+            continue;
+        const uint8_t* line = &src->buffer[(uint32_t)(row >> 3) * src->stride + sx];
+        if (direct && rows == 8 && (row & 7) == 0 && dy >= 0 && dy + 8 <= SSD1306_HEIGHT && ((dy + ring) & 7) == 0) {
+            uint8_t page = (uint8_t)(((dy + ring) & (SSD1306_HEIGHT - 1)) >> 3);
+            memcpy(&frame[page * SSD1306_WIDTH + x], line, (size_t)w);
+            if (layer)
+                ssd1306_MarkLayerSpan(page, (uint8_t)x, (uint8_t)(x + w - 1));
+            else
+                ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)(x + w - 1));
+            SSD1306_COUNT_N(column_writes, (uint32_t)w);
+            continue;
+        }
+        // Rows from an unaligned source row straddle two source pages, the second exists only inside the source.
+        uint8_t shift = row & 7;
+        bool carry = shift && (row - shift + 8) < (int16_t)src->height;
+        uint8_t mask = (uint8_t)(0xFF >> (8 - rows));
+        for (int16_t c = 0; c < w; c++) {
+            uint16_t bits = line[c];
+            if (carry)
+                bits |= (uint16_t)(line[c + src->stride] << 8);
+            ssd1306_PutColumn(x + c, dy, (uint8_t)(bits >> shift), mask);
+        }
+    }
+    return true;
+}
+
+bool ssd1306_WriteChar(int16_t x, int16_t y, char ch, FontDef font, bool color) {
+    // Single bytes are taken as Latin-1, the first 256 code points.
+    return ssd1306_WriteGlyph(x, y, (uint8_t)ch, font, color);
+}
+
+bool ssd1306_WriteGlyph(int16_t x, int16_t y, uint32_t code, FontDef font, bool color) {
+    const uint8_t* glyph = ssd1306_Font_Glyph(font, code);
+    if (!glyph) {
+        return false;
+    }
+    // Glyphs are stored column by column, one byte per column with the LSB at the top.
+    uint8_t rows = font.height >= 8 ? 0xFF : (uint8_t)((1u << font.height) - 1);
+    for (uint8_t col = 0; col < font.width; col++) {
+        uint8_t bits = glyph[col] & rows;
+        ssd1306_WriteColumn(x + col, y, color ? bits : 0, bits);
+    }
     return true;
 }
 
-bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint8_t len, FontDef font, bool color) {
-    const int16_t max_x       = SSD1306_WIDTH;
-    const int16_t max_y       = SSD1306_HEIGHT;
+bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint16_t len, FontDef font, bool color) {
+    const int16_t max_x       = ssd1306_TargetWidth();
+    const int16_t max_y       = ssd1306_TargetHeight();
     const int16_t line_height = font.height + 1;  // 1px spacing between lines
 
-    for (uint8_t i = 0; i < len; i++) {
+    for (uint16_t i = 0; i < len; ) {
+        uint32_t code = ssd1306_Utf8_Next(str, len, &i);
+
         // Wrap to next line if this glyph would exceed right edge
         if (x + font.width > max_x) {
             x = 0;                 // back to left margin
@@ -492,8 +1685,8 @@ bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint8_t len, Fon
             }
         }
 
-        // Draw the character; bail out if WriteChar fails
-        if (!ssd1306_WriteChar(x, y, str[i], font, color)) {
+        // Draw the character; bail out if the font has no glyph for it
+        if (!ssd1306_WriteGlyph(x, y, code, font, color)) {
             return false;
         }
 
@@ -504,6 +1697,194 @@ bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint8_t len, Fon
     return true;
 }
 
+/**
+ * @brief  Clips a rectangle to an area of width by height pixels.
+ * @retval true if part of the rectangle is left, false otherwise.
+ */
+static bool ssd1306_ClipRectTo(int16_t* x, int16_t* y, int16_t* w, int16_t* h, int16_t width, int16_t height) {
+    if (*x < 0) { *w += *x; *x = 0; }
+    if (*y < 0) { *h += *y; *y = 0; }
+    if (*x + *w > width) *w = (int16_t)(width - *x);
+    if (*y + *h > height) *h = (int16_t)(height - *y);
+    return *w > 0 && *h > 0;
+}
+
+/**
+ * @brief  Clips a rectangle to the screen.
+ * @retval true if part of the rectangle is left on screen, false otherwise.
+ */
+static bool ssd1306_ClipRect(int16_t* x, int16_t* y, int16_t* w, int16_t* h) {
+    return ssd1306_ClipRectTo(x, y, w, h, SSD1306_WIDTH, SSD1306_HEIGHT);
+}
+
+/**
+ * @brief  Rows of a page that lie in [y0, y1), as a page byte mask.
+ */
+static inline uint8_t ssd1306_PageRows(int32_t page, int32_t y0, int32_t y1) {
+    int32_t top = page * 8;
+    if (y0 < top) y0 = top;
+    if (y1 > top + 8) y1 = top + 8;
+    if (y0 >= y1) return 0;
+    return (uint8_t)((0xFFu >> (8 - (y1 - y0))) << (y0 - top));
+}
+
+/**
+ * @brief  Moves the rows in mask m of w columns from x of one page line by dx, clamped to (-w, w), and fills the
+ *         vacated columns.
+ */
+static void ssd1306_ShiftLine(uint8_t* line, uint8_t m, int16_t x, int16_t w, int16_t dx, bool fill) {
+    int16_t moved = (int16_t)(w - abs(dx));
+    int16_t dst = dx > 0 ? x + dx : x;
+    int16_t src = dx > 0 ? x : x - dx;
+    int16_t vacated = dx > 0 ? x : x + moved;
+    uint8_t fill_byte = fill ? 0xFF : 0x00;
+    if (m == 0xFF) {
+        if (moved)
+            memmove(&line[dst], &line[src], (size_t)moved);
+        memset(&line[vacated], fill_byte, (size_t)(w - moved));
+        return;
+    }
+    // Partial page, move only the region rows and keep the rest of each byte.
+    if (dx > 0) {
+        for (int16_t i = moved - 1; i >= 0; i--)
+            line[dst + i] = (uint8_t)((line[dst + i] & ~m) | (line[src + i] & m));
+    } else {
+        for (int16_t i = 0; i < moved; i++)
+            line[dst + i] = (uint8_t)((line[dst + i] & ~m) | (line[src + i] & m));
+    }
+    for (int16_t i = 0; i < w - moved; i++)
+        line[vacated + i] = (uint8_t)((line[vacated + i] & ~m) | (fill_byte & m));
+}
+
+/**
+ * @brief  Shifts a clipped region of the surface up or down by dy, clamped to (-h, h). Every destination byte is
+ *         built from the two source page bytes it straddles; downward shifts read the pages above and go bottom up,
+ *         upward shifts go top down, so no source byte is overwritten before it is read.
+ */
+static void ssd1306_ShiftSurfaceVertical(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dy, bool fill) {
+    int32_t first = y >> 3;
+    int32_t last = (y + h - 1) >> 3;
+    int32_t pages = (surface->height + 7) >> 3;
+    int32_t v0 = dy > 0 ? y : y + h + dy;
+    int32_t v1 = dy > 0 ? y + dy : y + h;
+    int32_t q = abs(dy) >> 3;
+    uint8_t b = (uint8_t)(abs(dy) & 7);
+    for (int16_t col = x; col < x + w; col++) {
+        uint8_t* column = &surface->buffer[col];
+        for (int32_t i = 0; i <= last - first; i++) {
+            int32_t page = dy > 0 ? last - i : first + i;
+            uint8_t region = ssd1306_PageRows(page, y, y + h);
+            uint8_t vacated = ssd1306_PageRows(page, v0, v1);
+            uint8_t moved = (uint8_t)(region & ~vacated);
+            uint8_t shifted = 0;
+            if (moved) {
+                int32_t src0 = dy > 0 ? page - q : page + q;
+                int32_t src1 = dy > 0 ? src0 - 1 : src0 + 1;
+                uint8_t a = src0 >= 0 && src0 < pages ? column[(uint32_t)src0 * surface->stride] : 0;
+                uint8_t c = b && src1 >= 0 && src1 < pages ? column[(uint32_t)src1 * surface->stride] : 0;
+                shifted = dy > 0 ? (uint8_t)((a << b) | (c >> (8 - b))) : (uint8_t)((a >> b) | (c << (8 - b)));
+            }
+            uint8_t* dst = &column[(uint32_t)page * surface->stride];
+            *dst = (uint8_t)((*dst & ~region) | (shifted & moved) | (fill ? vacated : 0));
+        }
+    }
+}
+
+bool ssd1306_ShiftHorizontal(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, bool fill) {
+    if (surface) {
+        if (!ssd1306_ClipRectTo(&x, &y, &w, &h, (int16_t)surface->width, (int16_t)surface->height))
+            return false;
+        if (dx > w) dx = w;
+        if (dx < -w) dx = (int16_t)-w;
+        for (int32_t page = y >> 3; dx && page <= (y + h - 1) >> 3; page++) {
+            uint8_t* line = &surface->buffer[(uint32_t)page * surface->stride];
+            ssd1306_ShiftLine(line, ssd1306_PageRows(page, y, y + h), x, w, dx, fill);
+        }
+        return true;
+    }
+    if (ssd1306_Redirected() || !ssd1306_ClipRect(&x, &y, &w, &h))
+        return false;
+    if (dx == 0)
+        return true;
+
+    // Rows of the region that fall in each page of the ring.
+    uint8_t masks[SSD1306_PAGES] = { 0 };
+    for (int16_t i = 0; i < h; i++) {
+        uint8_t row = (uint8_t)(y + i + scroll_offset) & (SSD1306_HEIGHT - 1);
+        masks[row >> 3] |= (uint8_t)(1 << (row & 7));
+    }
+
+    // A shift by the width or more vacates the whole region, clamping it keeps dst and src within the page.
+    if (dx > w) dx = w;
+    if (dx < -w) dx = (int16_t)-w;
+
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (!masks[page])
+            continue;
+        ssd1306_ShiftLine(&buffer[page * SSD1306_WIDTH], masks[page], x, w, dx, fill);
+        ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)(x + w - 1));
+    }
+    return true;
+}
+
+bool ssd1306_ShiftVertical(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dy, bool fill) {
+    if (surface) {
+        if (!ssd1306_ClipRectTo(&x, &y, &w, &h, (int16_t)surface->width, (int16_t)surface->height))
+            return false;
+        if (dy > h) dy = h;
+        if (dy < -h) dy = (int16_t)-h;
+        if (dy)
+            ssd1306_ShiftSurfaceVertical(x, y, w, h, dy, fill);
+        return true;
+    }
+    if (ssd1306_Redirected() || !ssd1306_ClipRect(&x, &y, &w, &h))
+        return false;
+    if (dy == 0)
+        return true;
+
+    // Region rows as a mask over a screen column, bit n is screen row n.
+    uint64_t region = (h == 64 ? ~(uint64_t)0 : (((uint64_t)1 << h) - 1)) << y;
+    uint64_t vacated;
+    if (dy >= h || dy <= -h)
+        vacated = region;
+    else if (dy > 0)
+        vacated = region & ~(region << dy);
+    else
+        vacated = region & ~(region >> -dy);
+    uint64_t fill_bits = fill ? vacated : 0;
+    uint8_t shift = scroll_offset;
+
+    for (int16_t col = x; col < x + w; col++) {
+        // Gather the 8 page bytes of the column, the shift carries bits across the page boundaries.
+        uint64_t column = 0;
+        for (uint8_t page = 0; page < SSD1306_PAGES; page++)
+            column |= (uint64_t)buffer[page * SSD1306_WIDTH + col] << (page * 8);
+        if (shift)
+            column = (column >> shift) | (column << (SSD1306_HEIGHT - shift));
+
+        uint64_t moved;
+        if (dy >= SSD1306_HEIGHT || dy <= -SSD1306_HEIGHT)
+            moved = 0;
+        else
+            moved = dy > 0 ? column << dy : column >> -dy;
+        column = (column & ~region) | (moved & region & ~vacated) | fill_bits;
+
+        if (shift)
+            column = (column << shift) | (column >> (SSD1306_HEIGHT - shift));
+        for (uint8_t page = 0; page < SSD1306_PAGES; page++)
+            buffer[page * SSD1306_WIDTH + col] = (uint8_t)(column >> (page * 8));
+    }
+
+    // Mark only the pages the region covers.
+    if (shift)
+        region = (region << shift) | (region >> (SSD1306_HEIGHT - shift));
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if ((uint8_t)(region >> (page * 8)))
+            ssd1306_MarkDirtySpan(page, (uint8_t)x, (uint8_t)(x + w - 1));
+    }
+    return true;
+}
+
 bool ssd1306_StartScroll(bool right, uint8_t startPage, uint8_t endPage, uint8_t speed, uint8_t topFixedRows, uint8_t scrollRows, uint8_t verticalOffset)
 {
     // Set vertical scroll area
@@ -528,4 +1909,261 @@ bool ssd1306_StartScroll(bool right, uint8_t startPage, uint8_t endPage, uint8_t
 
 bool ssd1306_StopScroll(void) {
     return ssd1306_WriteCommand(0x2E);
-}
\ No newline at end of file
+}
+
+bool ssd1306_ScrollFrame(int8_t rows, bool color) {
+    if (ssd1306_Redirected() || rows <= -SSD1306_HEIGHT || rows >= SSD1306_HEIGHT)
+        return false;
+    if (rows == 0)
+        return true;
+
+    scroll_offset = (uint8_t)(scroll_offset + rows) & (SSD1306_HEIGHT - 1);
+    start_line_pending = true;
+
+    // Rows that wrapped around the ring still hold the content that scrolled out, clear them in screen coordinates.
+    uint8_t first = rows > 0 ? (uint8_t)(SSD1306_HEIGHT - rows) : 0;
+    uint8_t count = rows > 0 ? (uint8_t)rows : (uint8_t)(-rows);
+    uint8_t masks[SSD1306_PAGES] = { 0 };
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t row = (uint8_t)(first + i + scroll_offset) & (SSD1306_HEIGHT - 1);
+        masks[row >> 3] |= (uint8_t)(1 << (row & 7));
+    }
+    for (uint8_t page = 0; page < SSD1306_PAGES; page++) {
+        if (!masks[page])
+            continue;
+        uint8_t* line = &buffer[page * SSD1306_WIDTH];
+        for (uint8_t x = 0; x < SSD1306_WIDTH; x++) {
+            if (color)
+                line[x] |= masks[page];
+            else
+                line[x] &= (uint8_t)~masks[page];
+        }
+        ssd1306_MarkDirtySpan(page, 0, SSD1306_WIDTH - 1);
+    }
+    return true;
+}
+
+bool ssd1306_ResetScroll(void) {
+    if (scroll_offset == 0)
+        return true;
+
+    // Rotate every column of the ring so that screen row 0 lands back in GDDRAM row 0.
+    for (uint8_t x = 0; x < SSD1306_WIDTH; x++) {
+        uint64_t column = 0;
+        for (uint8_t page = 0; page < SSD1306_PAGES; page++)
+            column |= (uint64_t)buffer[page * SSD1306_WIDTH + x] << (page * 8);
+        column = (column >> scroll_offset) | (column << (SSD1306_HEIGHT - scroll_offset));
+        for (uint8_t page = 0; page < SSD1306_PAGES; page++)
+            buffer[page * SSD1306_WIDTH + x] = (uint8_t)(column >> (page * 8));
+    }
+    scroll_offset = 0;
+    start_line_pending = true;
+    ssd1306_MarkAllDirty();
+    return true;
+}
+
+uint8_t ssd1306_GetScrollOffset(void) {
+    return scroll_offset;
+}
+
+uint8_t* ssd1306_GetFramebuffer(void) {
+    return buffer;
+}
+
+void ssd1306_GetDrawSize(int16_t* width, int16_t* height) {
+    if (width)
+        *width = ssd1306_TargetWidth();
+    if (height)
+        *height = ssd1306_TargetHeight();
+}
+
+bool ssd1306_MarkDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!ssd1306_ClipRect(&x, &y, &w, &h))
+        return false;
+    // Walk the rows page by page, the ring can wrap the region around the bottom of the buffer.
+    for (int16_t i = 0; i < h; ) {
+        uint8_t row = (uint8_t)(y + i + scroll_offset) & (SSD1306_HEIGHT - 1);
+        ssd1306_MarkDirtySpan(row >> 3, (uint8_t)x, (uint8_t)(x + w - 1));
+        i += 8 - (row & 7);
+    }
+    return true;
+}
+
+bool ssd1306_WriteRowBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t stride) {
+    if (!bitmap || w <= 0 || h <= 0 || stride < (uint16_t)((w + 7) / 8))
+        return false;
+    const int16_t max_x = ssd1306_TargetWidth();
+    const int16_t max_y = ssd1306_TargetHeight();
+    if (x >= max_x || y >= max_y || x + w <= 0 || y + h <= 0)
+        return false;
+
+    uint8_t rows[8];
+    uint8_t columns[8];
+    for (int16_t band = 0; band < h; band += 8) {
+        int16_t band_rows = h - band < 8 ? h - band : 8;
+        if (y + band + band_rows <= 0 || y + band >= max_y)
+            continue;
+        uint8_t mask = (uint8_t)(0xFF >> (8 - band_rows));
+        const uint8_t* src = &bitmap[band * stride];
+        for (int16_t bx = 0; bx * 8 < w; bx++) {
+            if (x + bx * 8 + 8 <= 0 || x + bx * 8 >= max_x)
+                continue;
+            // A short last band reads only the rows that exist.
+            for (uint8_t r = 0; r < 8; r++)
+                rows[r] = r < band_rows ? src[r * stride + bx] : 0;
+            ssd1306_Transpose8(rows, 1, columns);
+            uint8_t cols = w - bx * 8 < 8 ? (uint8_t)(w - bx * 8) : 8;
+            for (uint8_t c = 0; c < cols; c++)
+                ssd1306_PutColumn(x + bx * 8 + c, y + band, columns[c], mask);
+        }
+    }
+    return true;
+}
+
+bool ssd1306_UpdateArea(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (portrait) {
+        // The area is given in portrait coordinates, its blocks are all in the rotated dirty spans.
+        int16_t panel_x = (int16_t)(SSD1306_WIDTH - y - h);
+        y = x;
+        x = panel_x;
+        int16_t panel_w = h;
+        h = w;
+        w = panel_w;
+    }
+    if (!ssd1306_ClipRect(&x, &y, &w, &h))
+        return false;
+    if (!ssd1306_FrameAcquire(true))
+        return false;
+    ssd1306_FlushStartLine();
+    ssd1306_RotateDirty();
+    ssd1306_ComposeDirty();
+
+    uint8_t x0 = (uint8_t)x;
+    uint8_t x1 = (uint8_t)(x + w - 1);
+    uint8_t row = (uint8_t)(y + scroll_offset) & (SSD1306_HEIGHT - 1);
+    uint8_t first = row >> 3;
+    uint8_t count = (uint8_t)(((row & 7) + h + 7) / 8);
+    // On the ring the area can continue from the last page at page 0, that part gets a window of its own.
+    uint8_t spans[2][2] = { { first, 0 }, { 0, 0 } };
+    uint8_t windows = 1;
+    if (count >= SSD1306_PAGES) {
+        spans[0][0] = 0;
+        spans[0][1] = SSD1306_PAGES - 1;
+    } else if (first + count > SSD1306_PAGES) {
+        spans[0][1] = SSD1306_PAGES - 1;
+        spans[1][1] = (uint8_t)(first + count - 1 - SSD1306_PAGES);
+        windows = 2;
+    } else {
+        spans[0][1] = (uint8_t)(first + count - 1);
+    }
+
+    for (uint8_t win = 0; win < windows; win++) {
+        uint8_t page0 = spans[win][0];
+        uint8_t page1 = spans[win][1];
+        bool sent = ssd1306_SetWindow(x0, x1, page0, page1);
+        if (sent && x0 == 0 && x1 == SSD1306_WIDTH - 1) {
+            sent = ssd1306_WriteData(&buffer[page0 * SSD1306_WIDTH], (uint16_t)(page1 - page0 + 1) * SSD1306_WIDTH);
+        } else {
+            for (uint8_t p = page0; p <= page1 && sent; p++)
+                sent = ssd1306_WriteData(&buffer[p * SSD1306_WIDTH + x0], (uint16_t)(x1 - x0 + 1));
+        }
+        if (!sent) {
+            ssd1306_FrameRelease();
+            return false;
+        }
+        // Pages sent here no longer need the columns of the area, trim what is left of their dirty span.
+        for (uint8_t p = page0; p <= page1; p++) {
+            if (dirty_x0[p] > dirty_x1[p])
+                continue;
+            if (dirty_x0[p] >= x0 && dirty_x1[p] <= x1) {
+                dirty_x0[p] = 0xFF;
+                dirty_x1[p] = 0;
+            } else if (dirty_x0[p] >= x0 && dirty_x0[p] <= x1) {
+                dirty_x0[p] = (uint8_t)(x1 + 1);
+            } else if (dirty_x1[p] >= x0 && dirty_x1[p] <= x1) {
+                dirty_x1[p] = (uint8_t)(x0 - 1);
+            }
+        }
+    }
+
+    ssd1306_QueueStartLine();
+    ssd1306_FlushStartLine();
+    ssd1306_FrameRelease();
+    return true;
+}
+
+bool ssd1306_SetTarget(ssd1306_canvas_t* canvas) {
+    if (canvas && (!canvas->buffer || canvas->tiles_x == 0 || canvas->tiles_y == 0 ||
+                   canvas->tiles_x * canvas->tiles_y > SSD1306_CANVAS_MAX_TILES))
+        return false;
+    target = canvas;
+    return true;
+}
+
+bool ssd1306_SetRotation(ssd1306_rotation_t rotation, uint8_t* portrait_buffer) {
+    bool sideways = rotation == SSD1306_ROTATE_90 || rotation == SSD1306_ROTATE_270;
+    if (rotation > SSD1306_ROTATE_270 || (sideways && (!portrait_buffer || layer)))
+        return false;
+    // 180 degrees is the segment remap and COM scan direction both reversed, 270 is the 90 degree layout reversed too.
+    bool flip = rotation == SSD1306_ROTATE_180 || rotation == SSD1306_ROTATE_270;
+    if (!ssd1306_SetSegmentRemap(!flip) || !ssd1306_SetCOMOutputScanDirection(flip))
+        return false;
+    // The transposed blocks are placed from GDDRAM row 0.
+    if (sideways && !ssd1306_ResetScroll())
+        return false;
+    portrait = sideways ? portrait_buffer : NULL;
+    if (portrait) {
+        memset(portrait, 0, SSD1306_BUFFER_SIZE);
+        ssd1306_MarkPortraitAllDirty();
+    }
+    // The segment remap only applies to data written after it, everything is sent again.
+    ssd1306_MarkAllDirty();
+    return true;
+}
+
+bool ssd1306_SetLayers(uint8_t* background, uint8_t* foreground, uint8_t* mask) {
+    if (!background != !foreground || (mask && !background) || (background && portrait))
+        return false;
+    if (!background) {
+        // The frame buffer keeps the last composition and is drawn into directly again.
+        ssd1306_ComposeDirty();
+        memset(layers, 0, sizeof(layers));
+        layer = NULL;
+        return true;
+    }
+    // The composed bytes are placed from GDDRAM row 0.
+    if (!ssd1306_ResetScroll())
+        return false;
+    layers[SSD1306_LAYER_BACKGROUND] = background;
+    layers[SSD1306_LAYER_FOREGROUND] = foreground;
+    layers[SSD1306_LAYER_MASK] = mask;
+    for (uint8_t i = 0; i < SSD1306_LAYER_COUNT; i++) {
+        if (layers[i])
+            memset(layers[i], 0, SSD1306_BUFFER_SIZE);
+        memset(layer_x0[i], 0xFF, SSD1306_PAGES);
+        memset(layer_x1[i], 0, SSD1306_PAGES);
+    }
+    memset(compose_x0, 0, sizeof(compose_x0));
+    memset(compose_x1, SSD1306_WIDTH - 1, sizeof(compose_x1));
+    layer = foreground;
+    layer_index = SSD1306_LAYER_FOREGROUND;
+    return true;
+}
+
+bool ssd1306_SelectLayer(ssd1306_layer_t which) {
+    if (which >= SSD1306_LAYER_COUNT || !layers[which])
+        return false;
+    layer = layers[which];
+    layer_index = (uint8_t)which;
+    return true;
+}
+
+#ifdef SSD1306_ENABLE_STATS
+void ssd1306_GetDrawStats(ssd1306_draw_stats_t* stats) {
+    *stats = draw_stats;
+}
+
+void ssd1306_ResetDrawStats(void) {
+    memset(&draw_stats, 0, sizeof(draw_stats));
+}
+#endif
@@ -10,7 +10,150 @@
 #include "stdint.h"
 #include "ssd1306_fonts.h"
 #include "ssd1306_platform.h"
-#include "math.h"
+
+/**
+ * @brief Counts of frame buffer writes, only kept when built with SSD1306_ENABLE_STATS (host builds, benchmarks and tests).
+ */
+typedef struct {
+    uint32_t pixel_writes;  /**< Single pixel writes */
+    uint32_t column_writes; /**< Byte wide column writes of up to 8 pixels */
+} ssd1306_draw_stats_t;
+
+/**
+ * @brief 8x8 fill pattern, one byte per column with the LSB at the top like a frame buffer page. Patterns are anchored
+ *        to the drawing coordinates, column x uses columns[x % 8] and row y its bit y % 8, so adjacent fills line up.
+ */
+typedef struct {
+    uint8_t columns[8];
+} ssd1306_pattern_t;
+
+extern const ssd1306_pattern_t ssd1306_pattern_gray25; /**< 25% on, Bayer ordered like ssd1306_Dither_Pattern() */
+extern const ssd1306_pattern_t ssd1306_pattern_gray50; /**< Checkerboard */
+extern const ssd1306_pattern_t ssd1306_pattern_gray75; /**< 75% on */
+extern const ssd1306_pattern_t ssd1306_pattern_hatch;  /**< Diagonal lines rising to the right, 4 px apart */
+extern const ssd1306_pattern_t ssd1306_pattern_cross;  /**< Both diagonals, 4 px apart */
+
+/**
+ * @brief Line styles for ssd1306_DrawLineStyle(), bit n % 8 turns step n along the line on or off.
+ */
+#define SSD1306_LINE_SOLID    0xFF
+#define SSD1306_LINE_DASHED   0x3F
+#define SSD1306_LINE_DOTTED   0x55
+#define SSD1306_LINE_DASH_DOT 0x5F
+
+/**
+ * @brief Rectangle in drawing coordinates, w or h 0 for none.
+ */
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} ssd1306_area_t;
+
+/**
+ * @brief Pending vertical run search of ssd1306_FloodFill(), rows y0 to y1 of column x reached from column x - dir.
+ */
+typedef struct {
+    int16_t x;
+    int16_t y0;
+    int16_t y1;
+    int8_t  dir;
+} ssd1306_flood_span_t;
+
+/**
+ * @brief Entries of the stack ssd1306_FloodFill() uses when none is passed.
+ */
+#ifndef SSD1306_FLOOD_STACK
+#define SSD1306_FLOOD_STACK 64
+#endif
+
+/**
+ * @brief Largest number of 128x64 tiles in a canvas.
+ */
+#define SSD1306_CANVAS_MAX_TILES 16
+
+/**
+ * @brief Drawing surface made of tiles_x by tiles_y panel sized tiles, for signs built from several panels.
+ *        The buffer holds the tiles one after the other in row major order, each as 1024 bytes in the panel's own
+ *        page layout, so a tile is sent to its panel as is. See ssd1306_canvas.h for flushing the tiles.
+ */
+typedef struct {
+    uint8_t*  buffer;       /**< tiles_x * tiles_y * 1024 bytes */
+    uint8_t   tiles_x;      /**< Tiles across, the canvas is tiles_x * 128 pixels wide */
+    uint8_t   tiles_y;      /**< Tiles down, the canvas is tiles_y * 64 pixels high */
+    uint16_t  dirty_tiles;  /**< Bit per tile drawn into since it was last queued for sending */
+    uint8_t   panel[SSD1306_CANVAS_MAX_TILES]; /**< Platform panel showing each tile, see ssd1306_platform_init_panel() */
+    uint16_t  pending;      /**< Bit per tile queued and waiting for its bus */
+    uint16_t  in_flight;    /**< Bit per tile whose transfer has been started and not yet seen complete */
+} ssd1306_canvas_t;
+
+/**
+ * @brief Off-screen drawing surface of any size in the frame buffer's page layout: the byte of column x and page p is
+ *        buffer[p * stride + x], with the LSB at the top. A stride above the width lets a surface be a window into a
+ *        larger image.
+ */
+typedef struct {
+    uint8_t*  buffer;   /**< ((height + 7) / 8) * stride bytes */
+    uint16_t  width;    /**< Width in pixels */
+    uint16_t  height;   /**< Height in pixels */
+    uint16_t  stride;   /**< Bytes from one page row to the next, at least width */
+} ssd1306_surface_t;
+
+/**
+ * @brief Reset low time counted from panel power up, display ON settle time (tAF) and display OFF time (tOFF).
+ */
+#ifndef SSD1306_RESET_US
+#define SSD1306_RESET_US     2000
+#endif
+#ifndef SSD1306_POWER_ON_US
+#define SSD1306_POWER_ON_US  100000
+#endif
+#ifndef SSD1306_POWER_OFF_US
+#define SSD1306_POWER_OFF_US 100000
+#endif
+
+/**
+ * @brief States of the non-blocking power sequencing, see ssd1306_PowerPoll().
+ */
+typedef enum {
+    SSD1306_POWER_OFF = 0,  /**< Display off, or not started */
+    SSD1306_POWER_RESET,    /**< Waiting for the reset time to pass */
+    SSD1306_POWER_LOADING,  /**< Configuration, display ON and first frame on the bus */
+    SSD1306_POWER_SETTLING, /**< Display ON sent, waiting for tAF */
+    SSD1306_POWER_ON,       /**< Display on and settled */
+    SSD1306_POWER_STOPPING  /**< Display OFF sent, waiting for tOFF */
+} ssd1306_power_state_t;
+
+/**
+ * @brief Times of the last ssd1306_BootStart(), in microseconds from the call.
+ */
+typedef struct {
+    uint32_t loading_us;    /**< Transfer of the configuration, display ON and first frame started */
+    uint32_t frame_us;      /**< First frame in GDDRAM, drawing and flushing can go on from here */
+    uint32_t ready_us;      /**< First frame in GDDRAM and tAF passed, the frame is visible */
+    uint8_t  transactions;  /**< Bus transactions of the boot */
+} ssd1306_boot_stats_t;
+
+/**
+ * @brief Orientations of the drawing coordinates on the panel, clockwise.
+ */
+typedef enum {
+    SSD1306_ROTATE_0 = 0, /**< 128x64, as mounted */
+    SSD1306_ROTATE_90,    /**< 64x128 portrait, drawn into a buffer of its own and transposed at flush time */
+    SSD1306_ROTATE_180,   /**< 128x64 upside down, through the segment remap and COM scan direction, no cost */
+    SSD1306_ROTATE_270    /**< 64x128 portrait, the 90 degree layout upside down */
+} ssd1306_rotation_t;
+
+/**
+ * @brief Layers of ssd1306_SetLayers(), composited into the frame buffer at flush time.
+ */
+typedef enum {
+    SSD1306_LAYER_BACKGROUND = 0, /**< Static content such as grids, labels and logos, drawn once */
+    SSD1306_LAYER_FOREGROUND,     /**< Moving content, ORed over the background */
+    SSD1306_LAYER_MASK,           /**< Optional, set bits clear the background under the foreground */
+    SSD1306_LAYER_COUNT
+} ssd1306_layer_t;
 
 // Core functions.
 
@@ -30,7 +173,7 @@ bool ssd1306_Init(void);
 bool ssd1306_SetDisplayOffset(uint8_t offset);
 
 /**
- * @brief  Sets the display start line (row in GDDRAM mapped to COM0).
+ * @brief  Sets the display start line (row in GDDRAM mapped to COM0). Use ssd1306_ScrollFrame() instead to keep the drawing coordinates in sync.
  * @param  start_line The start line (0–63) for mapping GDDRAM to COM0.
  * @retval true if the start line command was sent successfully, false otherwise.
  */
@@ -111,6 +254,50 @@ bool ssd1306_PowerOnSequence(void);
  */
 bool ssd1306_PowerOffSequence(void);
 
+/**
+ * @brief  Starts a non-blocking boot in place of ssd1306_Init(). The configuration, display ON and the current frame
+ *         buffer, cleared or with a splash drawn into it, go out as one transaction. The frame lands while SEG/COM are
+ *         still off during tAF, which holds down to about 100 kHz. Only what is left of SSD1306_RESET_US is waited for.
+ *         Call ssd1306_PowerPoll() until it returns true.
+ * @param  now_us Time since the panel was powered up, in microseconds.
+ * @retval true once the boot has been started.
+ */
+bool ssd1306_BootStart(uint32_t now_us);
+
+/**
+ * @brief  Sends display ON and starts the tAF wait without blocking. Call ssd1306_PowerPoll() until it returns true.
+ * @param  now_us Current time in microseconds.
+ * @retval true if the command has been sent successfully, false otherwise.
+ */
+bool ssd1306_PowerOnStart(uint32_t now_us);
+
+/**
+ * @brief  Sends display OFF and starts the tOFF wait without blocking. Call ssd1306_PowerPoll() until it returns true
+ *         before removing the panel supply.
+ * @param  now_us Current time in microseconds.
+ * @retval true if the command has been sent successfully, false otherwise.
+ */
+bool ssd1306_PowerOffStart(uint32_t now_us);
+
+/**
+ * @brief  Advances the boot or power sequence started last. Does not block.
+ * @param  now_us Current time in microseconds, on the clock given to the start call.
+ * @retval true once the sequence has completed, false while it is still waiting.
+ */
+bool ssd1306_PowerPoll(uint32_t now_us);
+
+/**
+ * @brief  Provides the state of the non-blocking power sequencing.
+ * @retval Current state.
+ */
+ssd1306_power_state_t ssd1306_GetPowerState(void);
+
+/**
+ * @brief  Provides the times of the last ssd1306_BootStart().
+ * @param  stats Pointer to the structure to fill.
+ */
+void ssd1306_GetBootStats(ssd1306_boot_stats_t* stats);
+
 // Screen buffer management.
 
 /**
@@ -121,10 +308,38 @@ bool ssd1306_Clear(void);
 
 /**
  * @brief  Refreshes the display with the last developed frame. 
- * @retval true if the display is updated, false otherwise. 
+ *         After a ring scroll the new start line is sent once the frame is in GDDRAM; with a background transfer
+ *         that happens in ssd1306_FlushPoll() or the next flush. Until a background transfer is done, flushes on its
+ *         panel and flushes that compose layers or the portrait buffer into the frame buffer return false; drawing is
+ *         not held back and may reach the panel.
+ * @retval true if the frame transfer has been started, false otherwise. 
  */
 bool ssd1306_UpdateScreen(void);
 
+/**
+ * @brief  Sends only the parts of the frame that have been drawn to since they were last sent. 
+ *         Consecutive modified pages are sent through one column and page address window.
+ * @retval true if the modified areas have been sent, or nothing needed sending, false otherwise. 
+ */
+bool ssd1306_UpdateDirty(void);
+
+/**
+ * @brief  Starts sending a full frame from outside the frame buffer, through DMA where the platform supports it.
+ *         The frame buffer is marked as modified so the next update sends it again.
+ * @param  frame Pointer to a 1024 byte frame in the same page layout as the frame buffer, it must stay valid until
+ *         ssd1306_platform_is_dma_done() reports the transfer as finished. Flushes on the panel return false until
+ *         then, other panels stay free to transfer.
+ * @retval true if the transfer has been started, false otherwise. 
+ */
+bool ssd1306_SendFrame(const uint8_t* frame);
+
+/**
+ * @brief  Completes the last flush once its background transfer is done: sends the start line a ring scroll left
+ *         queued behind it. Does not block.
+ * @retval true if the last flush is complete, false while its transfer is still on the wire.
+ */
+bool ssd1306_FlushPoll(void);
+
 // Addressing and mapping
 
 /**
@@ -193,6 +408,34 @@ bool ssd1306_SetContrast(uint8_t contrast);
  */
 bool ssd1306_DrawPixel(uint8_t x, uint8_t y, bool color);
 
+/**
+ * @brief  Writes up to 8 vertically stacked pixels of one column in a single byte operation.
+ *         The pixels do not need to be page aligned, they are split across the pages they fall in.
+ * @param  x Horizontal component of the column.
+ * @param  y Vertical component of the top pixel, bit 0 of bits.
+ * @param  bits The pixel values, LSB at the top, same layout as a page byte.
+ * @param  mask The pixels to write, pixels with a cleared mask bit are left untouched.
+ * @retval true if the column has been written, false otherwise.
+ */
+bool ssd1306_WriteColumn(int16_t x, int16_t y, uint8_t bits, uint8_t mask);
+
+/**
+ * @brief  Inverts up to 8 vertically stacked pixels of one column in a single byte operation.
+ * @param  x Horizontal component of the column.
+ * @param  y Vertical component of the top pixel, bit 0 of bits.
+ * @param  bits The pixels to invert, LSB at the top.
+ * @retval true if the column is on screen, false otherwise.
+ */
+bool ssd1306_XorColumn(int16_t x, int16_t y, uint8_t bits);
+
+/**
+ * @brief  Reads 8 vertically stacked pixels of one column from the frame buffer.
+ * @param  x Horizontal component of the column.
+ * @param  y Vertical component of the top pixel, returned in bit 0.
+ * @retval The pixel values, LSB at the top. Pixels outside the screen read as off.
+ */
+uint8_t ssd1306_ReadColumn(int16_t x, int16_t y);
+
 /**
  * @brief  Draws a line on the display between the points passed.
  * @param  x0 Horizontal component of the first point of the line.
@@ -205,6 +448,19 @@ bool ssd1306_DrawPixel(uint8_t x, uint8_t y, bool color);
  */
 bool ssd1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool color);
 
+/**
+ * @brief  Draws a dashed or dotted line, the pixels of ssd1306_DrawLine() with the steps the style leaves out skipped.
+ * @param  x0 Horizontal component of the first point of the line.
+ * @param  y0 Vertical component of the first point of the line.
+ * @param  x1 Horizontal component of the end point of the line.
+ * @param  y1 Vertical component of the end point of the line.
+ * @param  thickness The number of pixels thick that the line is, as for ssd1306_DrawLine().
+ * @param  color Turn on or off for the monochromatic oled along the line.
+ * @param  style On and off steps repeating every 8 pixels, e.g. SSD1306_LINE_DASHED.
+ * @retval true if the line is drawn on the display, false otherwise.
+ */
+bool ssd1306_DrawLineStyle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool color, uint8_t style);
+
 /**
  * @brief  Draws a circle on the display, for a given center and radius. 
  * @param  x0 Horizontal component of the origin of the circle.
@@ -270,6 +526,147 @@ bool ssd1306_DrawPoly(int16_t* x, int16_t* y, uint8_t vertex_count, uint8_t thic
  */
 bool ssd1306_FillPoly(int16_t* x, int16_t* y, uint8_t vertex_count, bool color);
 
+/**
+ * @brief  Fills a rectangle with an 8x8 pattern, set pattern bits turn pixels on and clear bits turn them off.
+ *         Written as masked whole byte columns.
+ * @param  x Horizontal coordinate of the top‑left corner.
+ * @param  y Vertical coordinate of the top‑left corner.
+ * @param  w Width of the rectangle in pixels.
+ * @param  h Height of the rectangle in pixels.
+ * @param  pattern Pattern to fill with, e.g. &ssd1306_pattern_gray50.
+ * @retval true if the rectangle was filled, false if it is empty or the pattern is missing.
+ */
+bool ssd1306_FillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h, const ssd1306_pattern_t* pattern);
+
+/**
+ * @brief  Fills the pixels of ssd1306_FillCircle() with an 8x8 pattern, as masked whole byte columns.
+ * @param  x0 Horizontal component of the origin of the circle.
+ * @param  y0 Vertical component of the origin of the circle.
+ * @param  r Radius of the circle.
+ * @param  pattern Pattern to fill with.
+ * @retval true if the circle was filled, false if the pattern is missing.
+ */
+bool ssd1306_FillCirclePattern(int16_t x0, int16_t y0, uint16_t r, const ssd1306_pattern_t* pattern);
+
+/**
+ * @brief  Fills the pixels of ssd1306_FillPoly() with an 8x8 pattern, as masked whole byte columns.
+ * @param  x Pointer to the array of x axis components of the vertices for the polygon.
+ * @param  y Pointer to the array of y axis components of the vertices for the polygon.
+ * @param  vertex_count The number or vertices the polygon has.
+ * @param  pattern Pattern to fill with.
+ * @retval true if the polygon was filled, false if it has fewer than 3 vertices or the pattern is missing.
+ */
+bool ssd1306_FillPolyPattern(int16_t* x, int16_t* y, uint8_t vertex_count, const ssd1306_pattern_t* pattern);
+
+/**
+ * @brief  Fills the 4-connected region of same colored pixels around a point with color, which on a 1 bit display
+ *         is also the boundary fill up to pixels of color. Column runs are read and written as page bytes and the
+ *         pending runs are kept on a fixed stack, without recursion.
+ * @param  x Horizontal component of the seed point.
+ * @param  y Vertical component of the seed point.
+ * @param  color Color to fill with, nothing is done if the seed already has it.
+ * @param  stack Pending run stack, NULL for a static one of SSD1306_FLOOD_STACK entries shared by all callers.
+ * @param  stack_size Entries in the stack.
+ * @param  bounds Set to the area the fill changed, e.g. for ssd1306_UpdateArea(), may be NULL.
+ * @retval true if the region has been filled, false if the seed is outside the target or the stack ran out, in which
+ *         case part of the region is left unfilled and bounds covers what was filled.
+ */
+bool ssd1306_FloodFill(int16_t x, int16_t y, bool color, ssd1306_flood_span_t* stack, uint16_t stack_size, ssd1306_area_t* bounds);
+
+// Arcs and rotated shapes. Angles are whole degrees counter-clockwise from 3 o'clock, sines and cosines come from a
+// table in Q14, no floating point is used.
+
+/**
+ * @brief  Sine of an angle from a quarter wave table.
+ * @param  angle Angle in degrees, any value.
+ * @retval sin(angle) * 16384, rounded.
+ */
+int16_t ssd1306_Sin(int16_t angle);
+
+/**
+ * @brief  Cosine of an angle from a quarter wave table.
+ * @param  angle Angle in degrees, any value.
+ * @retval cos(angle) * 16384, rounded.
+ */
+int16_t ssd1306_Cos(int16_t angle);
+
+/**
+ * @brief  Point at a distance and angle from a center, rounded to the nearest pixel.
+ * @param  x0 Horizontal component of the center.
+ * @param  y0 Vertical component of the center.
+ * @param  r Distance from the center.
+ * @param  angle Angle in degrees.
+ * @param  x Set to the horizontal component of the point.
+ * @param  y Set to the vertical component of the point.
+ */
+void ssd1306_Polar(int16_t x0, int16_t y0, int16_t r, int16_t angle, int16_t* x, int16_t* y);
+
+/**
+ * @brief  Draws the part of a circle outline from the start angle counter-clockwise to the end angle. A 1 pixel arc
+ *         keeps the pixels of ssd1306_DrawCircle() by testing them against the two end directions, thick arcs are
+ *         filled bands written in byte columns.
+ * @param  x0 Horizontal component of the origin of the arc.
+ * @param  y0 Vertical component of the origin of the arc.
+ * @param  r Radius of the arc.
+ * @param  start Start angle in degrees.
+ * @param  end End angle in degrees, start + 360 or more for a full circle.
+ * @param  thickness The number of pixels thick that the arc is, growing inwards from the radius.
+ * @param  color Turn on or off the monochromatic oled along the arc.
+ * @retval true if the arc is drawn on the display, false otherwise.
+ */
+bool ssd1306_DrawArc(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, uint8_t thickness, bool color);
+
+/**
+ * @brief  Fills the part of ssd1306_FillCircle() from the start angle counter-clockwise to the end angle, in byte
+ *         columns.
+ * @param  x0 Horizontal component of the origin of the sector.
+ * @param  y0 Vertical component of the origin of the sector.
+ * @param  r Radius of the sector.
+ * @param  start Start angle in degrees.
+ * @param  end End angle in degrees, start + 360 or more for a full disc.
+ * @param  color Turn on or off the monochromatic oled inside the sector.
+ * @retval true if the sector is drawn on the display, false otherwise.
+ */
+bool ssd1306_FillPie(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, bool color);
+
+/**
+ * @brief  Draws a gauge needle or tick along a radius, a line for width 1 and a triangle tapering to the tip otherwise.
+ * @param  x0 Horizontal component of the gauge center.
+ * @param  y0 Vertical component of the gauge center.
+ * @param  r0 Distance of the base from the center, negative for a tail behind it.
+ * @param  r1 Distance of the tip from the center.
+ * @param  angle Angle of the needle in degrees.
+ * @param  width Width of the base in pixels.
+ * @param  color Turn on or off the monochromatic oled along the needle.
+ * @retval true if the needle is drawn on the display, false otherwise.
+ */
+bool ssd1306_DrawNeedle(int16_t x0, int16_t y0, int16_t r0, int16_t r1, int16_t angle, uint8_t width, bool color);
+
+/**
+ * @brief  Draws the outline of a rectangle turned around its center.
+ * @param  cx Horizontal component of the center.
+ * @param  cy Vertical component of the center.
+ * @param  w Width of the rectangle before turning.
+ * @param  h Height of the rectangle before turning.
+ * @param  angle Angle in degrees.
+ * @param  thickness Line thickness in pixels.
+ * @param  color Pixel on/off (true = on, false = off).
+ * @retval true if the rectangle was drawn, false if it is empty.
+ */
+bool ssd1306_DrawRectRotated(int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t angle, uint8_t thickness, bool color);
+
+/**
+ * @brief  Fills a rectangle turned around its center.
+ * @param  cx Horizontal component of the center.
+ * @param  cy Vertical component of the center.
+ * @param  w Width of the rectangle before turning.
+ * @param  h Height of the rectangle before turning.
+ * @param  angle Angle in degrees.
+ * @param  color Pixel on/off (true = on, false = off).
+ * @retval true if the rectangle was filled, false if it is empty.
+ */
+bool ssd1306_FillRectRotated(int16_t cx, int16_t cy, int16_t w, int16_t h, int16_t angle, bool color);
+
 /**
  * @brief  Draws a bitmap onto the display while maintaining anything else on the screen. 
  * @param  x The location of the horizontal component of the position of the top left bit.
@@ -290,21 +687,61 @@ bool ssd1306_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int w, int
  * @param  ch The character to be displayed. 
  * @param  font The font the character needs to be displayed in. 
  * @param  color Trun on or of the monochromatic oled along the character. 
- * @retval true if the character is displayed onto the image, false otherwise. 
+ * @retval true if the character is displayed onto the image, false if it is not covered by the font. 
  */
 bool ssd1306_WriteChar(int16_t x, int16_t y, char ch, FontDef font, bool color);
 
 /**
- * @brief  Writes a string onto the display. Additional or oversized characters beyond the display will be truncated.  
+ * @brief  Writes the glyph of a Unicode code point, looked up through the ranges of the font.
+ * @param  x The horizontal component of the top left position of the character.
+ * @param  y The vertical component of the top left position of the character.
+ * @param  code Unicode code point.
+ * @param  font The font the character needs to be displayed in.
+ * @param  color Turn on or off the monochromatic oled along the character.
+ * @retval true if the character is displayed onto the image, false if it is not covered by the font.
+ */
+bool ssd1306_WriteGlyph(int16_t x, int16_t y, uint32_t code, FontDef font, bool color);
+
+/**
+ * @brief  Writes a UTF-8 string onto the display. Additional or oversized characters beyond the display will be truncated.  
  * @param  x The horizontal component of the top left position of the first character in the string.
  * @param  y The vertical component of the top left position of the first character in the string.
  * @param  str Pointer to the character array containing the string. 
- * @param  len The length of the character array. 
+ * @param  len The length of the character array in bytes. 
  * @param  font The font the string needs to be displayed in. 
  * @param  color Trun on or of the monochromatic oled along the string. 
  * @retval true if the string is displayed onto the image, false otherwise. 
  */
-bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint8_t len, FontDef font, bool color);
+bool ssd1306_WriteString(int16_t x, int16_t y, const char* str, uint16_t len, FontDef font, bool color);
+
+// Frame buffer shifting
+
+/**
+ * @brief  Shifts a region of the frame buffer left or right, e.g. to scroll a strip chart by one sample. 
+ *         Full pages are moved with memmove, pages partly covered by the region keep their other rows.
+ * @param  x Horizontal coordinate of the top-left corner of the region.
+ * @param  y Vertical coordinate of the top-left corner of the region.
+ * @param  w Width of the region in pixels.
+ * @param  h Height of the region in pixels.
+ * @param  dx Number of columns to shift by, positive moves the content right, negative moves it left.
+ * @param  fill The color the vacated columns are filled with.
+ * @retval true if the region has been shifted, false if it is outside the screen, or drawing goes to a canvas, layers
+ *         or the 90 and 270 degree portrait buffer. With a surface set the region is shifted on the surface.
+ */
+bool ssd1306_ShiftHorizontal(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, bool fill);
+
+/**
+ * @brief  Shifts a region of the frame buffer up or down, carrying the bits across page boundaries. 
+ * @param  x Horizontal coordinate of the top-left corner of the region.
+ * @param  y Vertical coordinate of the top-left corner of the region.
+ * @param  w Width of the region in pixels.
+ * @param  h Height of the region in pixels.
+ * @param  dy Number of rows to shift by, positive moves the content down, negative moves it up.
+ * @param  fill The color the vacated rows are filled with.
+ * @retval true if the region has been shifted, false if it is outside the screen, or drawing goes to a canvas, layers
+ *         or the 90 and 270 degree portrait buffer. With a surface set the region is shifted on the surface.
+ */
+bool ssd1306_ShiftVertical(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dy, bool fill);
 
 // Scrolling effects. Hardware based
 
@@ -327,4 +764,186 @@ bool ssd1306_StartScroll(bool right, uint8_t startPage, uint8_t endPage, uint8_t
  */
 bool ssd1306_StopScroll(void);
 
-#endif
\ No newline at end of file
+// Scrolling effects. Start line based (ring framebuffer)
+
+/**
+ * @brief  Scrolls the frame vertically by moving the display start line instead of resending the GDDRAM. 
+ *         The frame buffer and GDDRAM are used as a vertical ring and drawing coordinates are translated, so the
+ *         application still sees a fixed screen. Only the exposed rows are cleared and marked for the next ssd1306_UpdateDirty().
+ * @param  rows Number of rows to scroll by (-63, 63). Positive moves the content up and exposes rows at the bottom, 
+ *         negative moves it down and exposes rows at the top.
+ * @param  color The color the exposed rows are cleared to.
+ * @retval true if the frame has been scrolled, false if rows is out of range or drawing goes elsewhere than the
+ *         frame buffer.
+ */
+bool ssd1306_ScrollFrame(int8_t rows, bool color);
+
+/**
+ * @brief  Rotates the frame buffer so the ring scroll offset is back at 0, keeping the picture as it is on screen.
+ *         The whole frame is marked for the next update.
+ * @retval true if the scroll offset has been reset, false otherwise.
+ */
+bool ssd1306_ResetScroll(void);
+
+/**
+ * @brief  Provides the GDDRAM row that is currently mapped to the top of the screen by ssd1306_ScrollFrame().
+ * @retval The current ring scroll offset (0, 63).
+ */
+uint8_t ssd1306_GetScrollOffset(void);
+
+// External renderers
+
+/**
+ * @brief  Provides the frame buffer for renderers that write page bytes themselves: 8 pages of 128 column bytes,
+ *         LSB at the top. Screen row y is in buffer row (y + ssd1306_GetScrollOffset()) % 64.
+ *         Writes through the pointer must be reported with ssd1306_MarkDirty() to be sent by ssd1306_UpdateDirty().
+ * @retval Pointer to the 1024 byte frame buffer.
+ */
+uint8_t* ssd1306_GetFramebuffer(void);
+
+/**
+ * @brief  Size of the area the drawing functions currently write to: the screen, the portrait buffer, a canvas or
+ *         a surface.
+ * @param  width Pointer to the width in pixels.
+ * @param  height Pointer to the height in pixels.
+ */
+void ssd1306_GetDrawSize(int16_t* width, int16_t* height);
+
+/**
+ * @brief  Marks a region as modified so the next ssd1306_UpdateDirty() sends it.
+ * @param  x Horizontal coordinate of the top-left corner of the region.
+ * @param  y Vertical coordinate of the top-left corner of the region.
+ * @param  w Width of the region in pixels.
+ * @param  h Height of the region in pixels.
+ * @retval true if part of the region is on screen, false otherwise.
+ */
+bool ssd1306_MarkDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief  Copies a row major 1bpp bitmap into the frame buffer, overwriting the region, set bits are lit pixels.
+ *         Blocks of 8x8 pixels are transposed into page bytes, e.g. for an LVGL I1 draw buffer.
+ * @param  x Horizontal coordinate of the top-left corner.
+ * @param  y Vertical coordinate of the top-left corner.
+ * @param  bitmap Pointer to the rows, the MSB of each byte is the leftmost pixel.
+ * @param  w Width of the bitmap in pixels.
+ * @param  h Height of the bitmap in pixels.
+ * @param  stride Bytes per row, at least (w + 7) / 8.
+ * @retval true if the bitmap has been copied, false if it is invalid or outside the screen.
+ */
+bool ssd1306_WriteRowBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t stride);
+
+/**
+ * @brief  Sends one region through a column and page address window, regardless of what else has been modified.
+ *         The region is widened to whole pages, those columns are taken off the modified areas.
+ * @param  x Horizontal coordinate of the top-left corner of the region.
+ * @param  y Vertical coordinate of the top-left corner of the region.
+ * @param  w Width of the region in pixels.
+ * @param  h Height of the region in pixels.
+ * @retval true if the region has been sent, false otherwise.
+ */
+bool ssd1306_UpdateArea(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Multi panel canvases
+
+/**
+ * @brief  Redirects the drawing functions to a canvas. Pixels, columns, shapes, bitmaps and text are drawn in canvas
+ *         coordinates and clipped to the canvas; ssd1306_Clear() clears the canvas. The scrolling, shifting and
+ *         update functions keep acting on the screen frame buffer.
+ * @param  canvas Canvas to draw into, NULL to draw into the screen frame buffer again.
+ * @retval true if the target has been set, false if the canvas has no buffer or more than SSD1306_CANVAS_MAX_TILES tiles.
+ */
+bool ssd1306_SetTarget(ssd1306_canvas_t* canvas);
+
+// Off-screen surfaces
+
+/**
+ * @brief  Sets up a surface over a caller provided buffer and clears it.
+ * @param  image Pointer to the surface.
+ * @param  pixels Pointer to ((height + 7) / 8) * stride bytes.
+ * @param  width Width in pixels.
+ * @param  height Height in pixels.
+ * @param  stride Bytes from one page row to the next, at least width.
+ * @retval true if the surface has been set up, false otherwise.
+ */
+bool ssd1306_InitSurface(ssd1306_surface_t* image, uint8_t* pixels, uint16_t width, uint16_t height, uint16_t stride);
+
+/**
+ * @brief  Redirects the drawing functions to an off-screen surface, ahead of any canvas, layer or rotation. Pixels,
+ *         columns, shapes, bitmaps and text are drawn in surface coordinates and clipped to the surface;
+ *         ssd1306_Clear() clears the surface. Widgets and text rendered once this way are put on screen with
+ *         ssd1306_Blit().
+ * @param  image Surface to draw into, NULL to draw where drawing went before.
+ * @retval true if the surface has been set, false if it has no buffer, no size or a stride below its width.
+ */
+bool ssd1306_SetSurface(ssd1306_surface_t* image);
+
+/**
+ * @brief  Copies a rectangle of a surface to the current drawing target, replacing the pixels under it. Onto the
+ *         frame buffer or a layer, source rows starting a page that land at the start of a page are copied a page
+ *         row at a time; other rows are shifted into masked byte wide column writes.
+ * @param  src Surface to copy from, not the one being drawn into.
+ * @param  sx Horizontal component of the top left of the rectangle in the surface.
+ * @param  sy Vertical component of the top left of the rectangle in the surface.
+ * @param  w Width of the rectangle.
+ * @param  h Height of the rectangle.
+ * @param  x Horizontal component of the destination.
+ * @param  y Vertical component of the destination.
+ * @retval true if part of the rectangle was copied, false if it is clipped away or the source is invalid.
+ */
+bool ssd1306_Blit(const ssd1306_surface_t* src, int16_t sx, int16_t sy, int16_t w, int16_t h, int16_t x, int16_t y);
+
+// Rotation
+
+/**
+ * @brief  Sets the orientation drawing coordinates map to. At 90 and 270 degrees drawing goes into a 64x128 portrait
+ *         buffer whose modified 8x8 blocks are transposed into the frame buffer by the next ssd1306_UpdateScreen(),
+ *         ssd1306_UpdateDirty() or ssd1306_UpdateArea(), which then take portrait coordinates too. Start line
+ *         scrolling and the frame buffer shifts are not available there. ssd1306_Init() restores 0 degrees.
+ * @param  rotation Orientation to use.
+ * @param  portrait_buffer 1024 bytes for 90 and 270 degrees, cleared here, ignored otherwise.
+ * @retval true if the orientation has been set, false if the buffer is missing, layers are on at 90 or 270 degrees
+ *         or the commands could not be sent.
+ */
+bool ssd1306_SetRotation(ssd1306_rotation_t rotation, uint8_t* portrait_buffer);
+
+// Layers
+
+/**
+ * @brief  Turns on layered drawing. The drawing functions write into the selected layer and ssd1306_Clear() clears
+ *         only the columns drawn into it since its last clear. ssd1306_UpdateScreen(), ssd1306_UpdateDirty() and
+ *         ssd1306_UpdateArea() first recombine the columns where any layer changed into the frame buffer as
+ *         (background & ~mask) | foreground, and only columns whose result changed are sent. A static background is
+ *         drawn once and the foreground is cleared and redrawn every frame. Start line scrolling, the frame buffer
+ *         shifts and the 90 and 270 degree rotations are not available while layers are on.
+ * @param  background 1024 bytes for the background layer, cleared here, NULL with foreground to turn layers off.
+ * @param  foreground 1024 bytes for the foreground layer, cleared here and selected.
+ * @param  mask 1024 bytes for the foreground mask, cleared here, NULL to OR the foreground over the background.
+ * @retval true if the layers have been set, false if a buffer is missing or the portrait rotation is in use.
+ */
+bool ssd1306_SetLayers(uint8_t* background, uint8_t* foreground, uint8_t* mask);
+
+/**
+ * @brief  Selects the layer the drawing functions write into.
+ * @param  which Layer to draw into.
+ * @retval true if the layer has been selected, false if layers are off or the layer has no buffer.
+ */
+bool ssd1306_SelectLayer(ssd1306_layer_t which);
+
+#ifdef SSD1306_ENABLE_STATS
+
+// Instrumentation
+
+/**
+ * @brief  Provides the frame buffer write counts since the last reset.
+ * @param  stats Pointer to the structure to fill.
+ */
+void ssd1306_GetDrawStats(ssd1306_draw_stats_t* stats);
+
+/**
+ * @brief  Resets the frame buffer write counts.
+ */
+void ssd1306_ResetDrawStats(void);
+
+#endif
+
+#endif
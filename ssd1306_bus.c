@@ -0,0 +1,112 @@
+/*
+*   ssd1306_bus.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifdef SSD1306_USE_HOST
+
+#include "ssd1306_bus.h"
+
+const ssd1306_bus_backend_t ssd1306_bus_stm32_hal = {
+    .name = "stm32_hal",
+    .data_chunk = 0,
+    .repeated_start = false,
+    .frame_overhead_us = 0,
+    .stream_frame = true,
+};
+
+const ssd1306_bus_backend_t ssd1306_bus_esp_arduino = {
+    .name = "esp_arduino",
+    .data_chunk = 16,
+    .repeated_start = true,     // endTransmission(false) between the pieces of one call.
+    .frame_overhead_us = 0,
+    .stream_frame = false,      // Streams do not fit the Wire buffer and are sent as commands and data.
+};
+
+const ssd1306_bus_backend_t ssd1306_bus_esp_idf = {
+    .name = "esp_idf",
+    .data_chunk = 16,
+    .repeated_start = false,
+    .frame_overhead_us = 0,
+    .stream_frame = true,
+};
+
+const ssd1306_bus_backend_t ssd1306_bus_single = {
+    .name = "single",
+    .data_chunk = 0,
+    .repeated_start = false,
+    .frame_overhead_us = 0,
+    .stream_frame = true,
+};
+
+/**
+ * @brief  Adds one frame carrying the address, the control byte and payload bytes. The closing STOP is added by the caller.
+ */
+static void ssd1306_Bus_AddFrame(const ssd1306_bus_backend_t* backend, uint16_t payload, ssd1306_bus_cost_t* cost){
+    cost->frames++;
+    cost->bytes += 2u + payload;
+    cost->bits += 1u + 9u * (2u + payload); // START or repeated START, then 9 clocks per byte.
+    cost->overhead_us += backend->frame_overhead_us;
+}
+
+/**
+ * @brief  Adds the frames of a run of payload split into chunks, chunk 0 for a single frame.
+ * @retval Number of frames added.
+ */
+static uint32_t ssd1306_Bus_AddChunks(const ssd1306_bus_backend_t* backend, uint16_t size, uint16_t chunk, ssd1306_bus_cost_t* cost){
+    if (chunk == 0) {
+        ssd1306_Bus_AddFrame(backend, size, cost);
+        return 1;
+    }
+    uint32_t frames = 0;
+    while (size > 0) {
+        uint16_t n = size > chunk ? chunk : size;
+        ssd1306_Bus_AddFrame(backend, n, cost);
+        size = (uint16_t)(size - n);
+        frames++;
+    }
+    return frames;
+}
+
+void ssd1306_Bus_AddTransaction(const ssd1306_bus_backend_t* backend, ssd1306_host_kind_t kind, uint16_t size, ssd1306_bus_cost_t* cost){
+    if (size == 0) {
+        return;
+    }
+    uint32_t frames;
+    if (kind == SSD1306_HOST_STREAM && backend->stream_frame) {
+        ssd1306_Bus_AddFrame(backend, size, cost);  // The logged size leaves out the first control byte, counted by the frame.
+        frames = 1;
+    } else if (kind == SSD1306_HOST_DATA || kind == SSD1306_HOST_DATA_DMA || kind == SSD1306_HOST_STREAM) {
+        frames = ssd1306_Bus_AddChunks(backend, size, backend->data_chunk, cost);
+    } else {
+        ssd1306_Bus_AddFrame(backend, size, cost);  // Commands and command lists go out in one frame on every backend.
+        frames = 1;
+    }
+    // One STOP per frame, or a single one when the frames are joined by repeated STARTs.
+    cost->bits += backend->repeated_start ? 1u : frames;
+}
+
+bool ssd1306_Bus_AddLog(const ssd1306_bus_backend_t* backend, ssd1306_bus_cost_t* cost){
+    uint32_t count;
+    const ssd1306_host_transaction_t* log = ssd1306_host_log(&count);
+    for (uint32_t i = 0; i < count; i++) {
+        ssd1306_Bus_AddTransaction(backend, log[i].kind, log[i].size, cost);
+    }
+    ssd1306_host_stats_t stats;
+    ssd1306_host_get_stats(&stats);
+    return stats.log_dropped == 0;
+}
+
+uint32_t ssd1306_Bus_TimeUs(const ssd1306_bus_cost_t* cost, uint32_t bus_hz){
+    if (bus_hz == 0) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)cost->bits * 1000000ULL + bus_hz - 1) / bus_hz) + cost->overhead_us;
+}
+
+uint32_t ssd1306_Bus_MaxFps(const ssd1306_bus_cost_t* cost, uint32_t bus_hz){
+    uint32_t us = ssd1306_Bus_TimeUs(cost, bus_hz);
+    return us ? 1000000UL / us : 0;
+}
+
+#endif // SSD1306_USE_HOST
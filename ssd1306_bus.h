@@ -0,0 +1,91 @@
+/*
+*   ssd1306_bus.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_BUS_H
+#define SSD1306_BUS_H
+
+#include "ssd1306_platform.h"
+
+#ifdef SSD1306_USE_HOST
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * I2C bus time model. The transactions recorded by the simulated display are expanded into the I2C frames a
+ * backend would put on the wire: START, address, control byte, payload and STOP, 9 clocks per byte with the ACK.
+ * A repeated START costs one clock less than a STOP followed by a START.
+ */
+
+/**
+ * @brief How a platform backend splits the platform calls into I2C frames.
+ */
+typedef struct {
+    const char* name;
+    uint16_t    data_chunk;          /**< Payload bytes per data frame, 0 for a single frame */
+    bool        repeated_start;      /**< Frames of one call are joined by a repeated START instead of STOP and START */
+    uint16_t    frame_overhead_us;   /**< Software time per frame, measured on the target, 0 for wire time only */
+    bool        stream_frame;        /**< Command and data streams go out as one frame, otherwise they are split like data */
+} ssd1306_bus_backend_t;
+
+/**
+ * @brief Backends as implemented by the platform files.
+ */
+extern const ssd1306_bus_backend_t ssd1306_bus_stm32_hal;    /**< ssd1306_platform_stm32.c, HAL_I2C_Mem_Write() */
+extern const ssd1306_bus_backend_t ssd1306_bus_esp_arduino;  /**< ssd1306_platform_esp32.cpp, Wire in 16 byte pieces */
+extern const ssd1306_bus_backend_t ssd1306_bus_esp_idf;      /**< ssd1306_platform_esp32.cpp, one command link per 16 bytes */
+extern const ssd1306_bus_backend_t ssd1306_bus_single;       /**< One frame per call, the lower bound for any backend */
+
+/**
+ * @brief Accumulated wire cost of a sequence of transactions.
+ */
+typedef struct {
+    uint32_t frames;      /**< I2C frames, one address phase each */
+    uint32_t bytes;       /**< Bytes on the wire including address and control bytes */
+    uint32_t bits;        /**< Clocks including ACK, START and STOP */
+    uint32_t overhead_us; /**< Software overhead of the frames */
+} ssd1306_bus_cost_t;
+
+/**
+ * @brief  Adds the wire cost of one platform call.
+ * @param  backend Backend that splits the call into frames.
+ * @param  kind Kind of the platform call.
+ * @param  size Payload bytes of the call.
+ * @param  cost Pointer to the accumulated cost.
+ */
+void ssd1306_Bus_AddTransaction(const ssd1306_bus_backend_t* backend, ssd1306_host_kind_t kind, uint16_t size, ssd1306_bus_cost_t* cost);
+
+/**
+ * @brief  Adds the wire cost of every transaction recorded by the simulated display since ssd1306_host_reset_stats().
+ * @param  backend Backend that splits the calls into frames.
+ * @param  cost Pointer to the accumulated cost.
+ * @retval true if the cost covers all transactions, false if the log dropped some.
+ */
+bool ssd1306_Bus_AddLog(const ssd1306_bus_backend_t* backend, ssd1306_bus_cost_t* cost);
+
+/**
+ * @brief  Converts a cost into time on the bus.
+ * @param  cost Pointer to the cost.
+ * @param  bus_hz I2C clock.
+ * @retval Time in microseconds, rounded up.
+ */
+uint32_t ssd1306_Bus_TimeUs(const ssd1306_bus_cost_t* cost, uint32_t bus_hz);
+
+/**
+ * @brief  Maximum rate a flush of the given cost can be repeated at, with the bus fully used.
+ * @param  cost Pointer to the cost of one flush.
+ * @param  bus_hz I2C clock.
+ * @retval Flushes per second, rounded down.
+ */
+uint32_t ssd1306_Bus_MaxFps(const ssd1306_bus_cost_t* cost, uint32_t bus_hz);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SSD1306_USE_HOST
+
+#endif // SSD1306_BUS_H
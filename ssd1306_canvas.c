@@ -0,0 +1,80 @@
+/*
+*   ssd1306_canvas.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_canvas.h"
+#include <string.h>
+
+#define SSD1306_TILE_SIZE 1024
+
+static inline uint8_t ssd1306_Canvas_Tiles(const ssd1306_canvas_t* canvas){
+    return (uint8_t)(canvas->tiles_x * canvas->tiles_y);
+}
+
+bool ssd1306_Canvas_Init(ssd1306_canvas_t* canvas, uint8_t* buffer, uint8_t tiles_x, uint8_t tiles_y, const uint8_t* panels){
+    if (!canvas || !buffer || !panels || tiles_x == 0 || tiles_y == 0 || tiles_x * tiles_y > SSD1306_CANVAS_MAX_TILES) {
+        return false;
+    }
+    canvas->buffer = buffer;
+    canvas->tiles_x = tiles_x;
+    canvas->tiles_y = tiles_y;
+    uint8_t tiles = ssd1306_Canvas_Tiles(canvas);
+    memcpy(canvas->panel, panels, tiles);
+    memset(buffer, 0, (size_t)tiles * SSD1306_TILE_SIZE);
+    canvas->dirty_tiles = (uint16_t)((1ul << tiles) - 1);
+    canvas->pending = 0;
+    canvas->in_flight = 0;
+    return true;
+}
+
+bool ssd1306_Canvas_InitPanels(ssd1306_canvas_t* canvas){
+    uint8_t selected = ssd1306_platform_selected();
+    bool ok = true;
+    for (uint8_t t = 0; t < ssd1306_Canvas_Tiles(canvas); t++) {
+        if (!ssd1306_platform_select(canvas->panel[t]) || !ssd1306_Init()) {
+            ok = false;
+        }
+    }
+    ssd1306_platform_select(selected);
+    return ok;
+}
+
+bool ssd1306_Canvas_Flush(ssd1306_canvas_t* canvas){
+    uint8_t selected = ssd1306_platform_selected();
+    for (uint8_t t = 0; t < ssd1306_Canvas_Tiles(canvas); t++) {
+        if ((canvas->dirty_tiles >> t & 1) && !ssd1306_platform_select(canvas->panel[t])) {
+            ssd1306_platform_select(selected);
+            return false;
+        }
+    }
+    ssd1306_platform_select(selected);
+    canvas->pending |= canvas->dirty_tiles;
+    canvas->dirty_tiles = 0;
+    ssd1306_Canvas_Poll(canvas);
+    return true;
+}
+
+bool ssd1306_Canvas_Poll(ssd1306_canvas_t* canvas){
+    uint8_t selected = ssd1306_platform_selected();
+    for (uint8_t t = 0; t < ssd1306_Canvas_Tiles(canvas); t++) {
+        uint16_t bit = (uint16_t)(1u << t);
+        if (!((canvas->pending | canvas->in_flight) & bit)) {
+            continue;
+        }
+        // A busy bus is either still sending this tile or another panel on the same bus, check again next call.
+        if (!ssd1306_platform_select(canvas->panel[t]) || !ssd1306_platform_is_dma_done()) {
+            continue;
+        }
+        canvas->in_flight &= (uint16_t)~bit;
+        if ((canvas->pending & bit) && ssd1306_SendFrame(&canvas->buffer[(uint32_t)t * SSD1306_TILE_SIZE])) {
+            canvas->pending &= (uint16_t)~bit;
+            // Blocking platforms have already finished the transfer.
+            if (!ssd1306_platform_is_dma_done()) {
+                canvas->in_flight |= bit;
+            }
+        }
+    }
+    ssd1306_platform_select(selected);
+    return (canvas->pending | canvas->in_flight) == 0;
+}
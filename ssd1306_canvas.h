@@ -0,0 +1,69 @@
+/*
+*   ssd1306_canvas.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_CANVAS_H
+#define SSD1306_CANVAS_H
+
+#include "ssd1306.h"
+
+/*
+ * Signs built from several panels. A canvas is drawn with the regular drawing functions after ssd1306_SetTarget(),
+ * then every tile that was drawn into is sent to its panel. Tiles are started as soon as the bus of their panel is
+ * free, so panels on separate I2C buses are written at the same time and a frame takes about as long as the slowest
+ * bus rather than the sum of all panels. Panels sharing a bus are sent one after the other.
+ *
+ * A 256x64 sign on two buses:
+ *
+ *   static uint8_t sign_buffer[2 * 1024];
+ *   static ssd1306_canvas_t sign;
+ *   static const uint8_t sign_panels[] = { 0, 1 };
+ *
+ *   ssd1306_platform_init_panel(0, &hi2c1, &hdma_i2c1_tx, 0x3C);
+ *   ssd1306_platform_init_panel(1, &hi2c2, &hdma_i2c2_tx, 0x3C);
+ *   ssd1306_Canvas_Init(&sign, sign_buffer, 2, 1, sign_panels);
+ *   ssd1306_Canvas_InitPanels(&sign);
+ *
+ *   ssd1306_SetTarget(&sign);
+ *   ssd1306_WriteString(100, 28, "ACROSS THE SEAM", 15, Font_5x8, true);
+ *   ssd1306_Canvas_Flush(&sign);
+ *   while (!ssd1306_Canvas_Poll(&sign)) { }
+ */
+
+/**
+ * @brief  Sets up a canvas over a caller provided buffer and clears it. Every tile starts modified since the panel
+ *         contents are unknown.
+ * @param  canvas Pointer to the canvas.
+ * @param  buffer Pointer to tiles_x * tiles_y * 1024 bytes.
+ * @param  tiles_x Tiles across.
+ * @param  tiles_y Tiles down, tiles_x * tiles_y must not exceed SSD1306_CANVAS_MAX_TILES.
+ * @param  panels Platform panel of every tile in row major order.
+ * @retval true if the canvas has been set up, false otherwise.
+ */
+bool ssd1306_Canvas_Init(ssd1306_canvas_t* canvas, uint8_t* buffer, uint8_t tiles_x, uint8_t tiles_y, const uint8_t* panels);
+
+/**
+ * @brief  Runs ssd1306_Init() on the panel of every tile, the panels must have been set up with ssd1306_platform_init_panel().
+ * @param  canvas Pointer to the canvas.
+ * @retval true if every panel has been initialized, false otherwise.
+ */
+bool ssd1306_Canvas_InitPanels(ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Queues every tile drawn into since the last flush and starts the transfers whose bus is free.
+ *         Tiles must not be drawn into until ssd1306_Canvas_Poll() reports the flush complete.
+ * @param  canvas Pointer to the canvas.
+ * @retval true if the tiles have been queued, false if a tile's panel cannot be selected.
+ */
+bool ssd1306_Canvas_Flush(ssd1306_canvas_t* canvas);
+
+/**
+ * @brief  Starts the queued tiles whose bus has become free and checks the transfers in flight. A tile that fails
+ *         to start stays queued and is retried by the next call.
+ * @param  canvas Pointer to the canvas.
+ * @retval true once every queued tile has been sent and its transfer has completed, false while any is outstanding.
+ */
+bool ssd1306_Canvas_Poll(ssd1306_canvas_t* canvas);
+
+#endif // SSD1306_CANVAS_H
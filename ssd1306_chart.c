@@ -0,0 +1,45 @@
+/*
+*   ssd1306_chart.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_chart.h"
+
+bool ssd1306_Chart_Init(ssd1306_chart_t* chart, int16_t x, int16_t y, int16_t w, int16_t h, int32_t min, int32_t max, bool color){
+    if (w <= 0 || h <= 0 || max <= min) {
+        return false;
+    }
+    chart->x = x;
+    chart->y = y;
+    chart->w = w;
+    chart->h = h;
+    chart->min = min;
+    chart->max = max;
+    chart->last_row = -1;
+    chart->color = color;
+    return ssd1306_FillRect(x, y, w, h, !color);
+}
+
+bool ssd1306_Chart_Draw(ssd1306_chart_t* chart, int32_t value){
+    if (value < chart->min) value = chart->min;
+    if (value > chart->max) value = chart->max;
+    int16_t row = (int16_t)(chart->y + chart->h - 1 -
+                            (int32_t)((int64_t)(value - chart->min) * (chart->h - 1) / (chart->max - chart->min)));
+    int16_t col = chart->x + chart->w - 1;
+
+    if (!ssd1306_ShiftHorizontal(chart->x, chart->y, chart->w, chart->h, -1, !chart->color)) {
+        return false;
+    }
+    // Join to the previous sample so steep edges stay continuous.
+    int16_t from = chart->last_row < 0 ? row : chart->last_row;
+    ssd1306_DrawLine(col, from, col, row, 1, chart->color);
+    chart->last_row = row;
+    return true;
+}
+
+bool ssd1306_Chart_Push(ssd1306_chart_t* chart, int32_t value){
+    if (!ssd1306_Chart_Draw(chart, value)) {
+        return false;
+    }
+    return ssd1306_UpdateDirty();
+}
@@ -0,0 +1,56 @@
+/*
+*   ssd1306_chart.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_CHART_H
+#define SSD1306_CHART_H
+
+#include "ssd1306.h"
+
+/**
+ * @brief Rolling strip chart, new samples enter at the right edge and the trace scrolls left.
+ */
+typedef struct {
+    int16_t x;          /**< Left edge of the chart area */
+    int16_t y;          /**< Top edge of the chart area */
+    int16_t w;          /**< Width of the chart area, one sample per column */
+    int16_t h;          /**< Height of the chart area */
+    int32_t min;        /**< Sample value drawn on the bottom row */
+    int32_t max;        /**< Sample value drawn on the top row */
+    int16_t last_row;   /**< Row of the previous sample, -1 until the first sample */
+    bool    color;      /**< Trace color, the background is the opposite color */
+} ssd1306_chart_t;
+
+/**
+ * @brief  Sets up a chart over an area of the screen and clears that area.
+ * @param  chart Pointer to the chart to set up.
+ * @param  x Left edge of the chart area.
+ * @param  y Top edge of the chart area.
+ * @param  w Width of the chart area in pixels.
+ * @param  h Height of the chart area in pixels.
+ * @param  min Sample value at the bottom of the chart.
+ * @param  max Sample value at the top of the chart, must be greater than min.
+ * @param  color Trace color.
+ * @retval true if the chart has been set up, false otherwise.
+ */
+bool ssd1306_Chart_Init(ssd1306_chart_t* chart, int16_t x, int16_t y, int16_t w, int16_t h, int32_t min, int32_t max, bool color);
+
+/**
+ * @brief  Adds a sample to the chart. The chart area is shifted left by one column, the new column is drawn
+ *         joined to the previous sample, and only the chart area is sent to the display.
+ * @param  chart Pointer to the chart.
+ * @param  value The sample, values outside min and max are clamped to the chart edges.
+ * @retval true if the sample has been drawn and sent, false otherwise.
+ */
+bool ssd1306_Chart_Push(ssd1306_chart_t* chart, int32_t value);
+
+/**
+ * @brief  Adds a sample to the chart without sending anything, for charts updated together with other content.
+ * @param  chart Pointer to the chart.
+ * @param  value The sample, values outside min and max are clamped to the chart edges.
+ * @retval true if the sample has been drawn, false otherwise.
+ */
+bool ssd1306_Chart_Draw(ssd1306_chart_t* chart, int32_t value);
+
+#endif // SSD1306_CHART_H
@@ -0,0 +1,114 @@
+/*
+*   ssd1306_console.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_console.h"
+#include <string.h>
+
+// Fixed ring of the lines on screen, lines[(top + row) % SSD1306_CONSOLE_ROWS] is shown at text row `row`.
+static char lines[SSD1306_CONSOLE_ROWS][SSD1306_CONSOLE_COLUMNS];
+static uint8_t top = 0;
+static uint8_t cursor_row = 0;
+static uint8_t cursor_col = 0;
+static bool text_color = true;
+// A '\n' only takes effect with the next character, so a printed line and the scroll it causes share one page update.
+static bool newline_pending = false;
+
+/**
+ * @brief  Draws one character cell, glyph and spacing column, over its background.
+ * @param  col Text column of the cell.
+ * @param  row Text row of the cell.
+ * @param  ch The character to draw, anything outside the font is drawn blank.
+ */
+static void ssd1306_Console_DrawCell(uint8_t col, uint8_t row, char ch){
+    int16_t x = (int16_t)col * SSD1306_CONSOLE_CELL_WIDTH;
+    int16_t y = (int16_t)row * 8;
+    uint8_t ink = text_color ? 0x00 : 0xFF;
+    uint8_t code = (uint8_t)ch;
+
+    if (code >= 32 && code <= 127) {
+        // Font_5x8 glyphs are stored as page bytes, one per column.
+        const uint8_t* glyph = &Font_5x8.data[(code - 32) * Font_5x8.width];
+        for (uint8_t i = 0; i < Font_5x8.width; i++) {
+            ssd1306_WriteColumn(x + i, y, glyph[i] ^ ink, 0xFF);
+        }
+    } else {
+        for (uint8_t i = 0; i < Font_5x8.width; i++) {
+            ssd1306_WriteColumn(x + i, y, ink, 0xFF);
+        }
+    }
+    ssd1306_WriteColumn(x + Font_5x8.width, y, ink, 0xFF);
+}
+
+/**
+ * @brief  Moves the cursor to the start of the next line, scrolling the screen by one text row once the bottom is reached.
+ * @retval true if the new line is ready, false otherwise.
+ */
+static bool ssd1306_Console_NewLine(void){
+    cursor_col = 0;
+    newline_pending = false;
+    if (cursor_row + 1 < SSD1306_CONSOLE_ROWS) {
+        cursor_row++;
+        return true;
+    }
+    // The oldest line leaves the ring and its slot becomes the new bottom line.
+    memset(lines[top], ' ', SSD1306_CONSOLE_COLUMNS);
+    top = (top + 1) % SSD1306_CONSOLE_ROWS;
+    return ssd1306_ScrollFrame(8, !text_color);
+}
+
+bool ssd1306_Console_Init(bool color){
+    text_color = color;
+    if (!ssd1306_ResetScroll()) return false;
+    return ssd1306_Console_Clear();
+}
+
+bool ssd1306_Console_Write(const char* str, uint16_t len){
+    for (uint16_t i = 0; i < len; i++) {
+        char ch = str[i];
+        if (ch == '\n') {
+            if (newline_pending && !ssd1306_Console_NewLine()) return false;
+            newline_pending = true;
+            continue;
+        }
+        if (ch == '\r') {
+            cursor_col = 0;
+            continue;
+        }
+        if (newline_pending || cursor_col == SSD1306_CONSOLE_COLUMNS) {
+            if (!ssd1306_Console_NewLine()) return false;
+        }
+        lines[(top + cursor_row) % SSD1306_CONSOLE_ROWS][cursor_col] = ch;
+        ssd1306_Console_DrawCell(cursor_col, cursor_row, ch);
+        cursor_col++;
+    }
+    return true;
+}
+
+bool ssd1306_Console_PrintLine(const char* str){
+    if (!ssd1306_Console_Write(str, (uint16_t)strlen(str))) return false;
+    if (!ssd1306_Console_Write("\n", 1)) return false;
+    return ssd1306_UpdateDirty();
+}
+
+bool ssd1306_Console_Clear(void){
+    memset(lines, ' ', sizeof(lines));
+    top = 0;
+    cursor_row = 0;
+    cursor_col = 0;
+    newline_pending = false;
+    return ssd1306_FillRect(0, 0, 128, 64, !text_color);
+}
+
+bool ssd1306_Console_Redraw(void){
+    for (uint8_t row = 0; row < SSD1306_CONSOLE_ROWS; row++) {
+        const char* line = lines[(top + row) % SSD1306_CONSOLE_ROWS];
+        for (uint8_t col = 0; col < SSD1306_CONSOLE_COLUMNS; col++) {
+            ssd1306_Console_DrawCell(col, row, line[col]);
+        }
+    }
+    // Columns past the last full cell are not covered by any cell.
+    return ssd1306_FillRect(SSD1306_CONSOLE_COLUMNS * SSD1306_CONSOLE_CELL_WIDTH, 0,
+                            128 - SSD1306_CONSOLE_COLUMNS * SSD1306_CONSOLE_CELL_WIDTH, 64, !text_color);
+}
@@ -0,0 +1,52 @@
+/*
+*   ssd1306_console.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_CONSOLE_H
+#define SSD1306_CONSOLE_H
+
+#include "ssd1306.h"
+
+// Text cells are the 5x8 glyph plus one column of spacing, one text row per page.
+#define SSD1306_CONSOLE_CELL_WIDTH  6
+#define SSD1306_CONSOLE_COLUMNS     (128 / SSD1306_CONSOLE_CELL_WIDTH)
+#define SSD1306_CONSOLE_ROWS        (64 / 8)
+
+/**
+ * @brief  Takes over the whole screen as a scrolling text console using Font_5x8. 
+ *         New lines are brought in with ssd1306_ScrollFrame(), so each one only costs one page and a start line command.
+ * @param  color Color of the text, the background is the opposite color.
+ * @retval true if the console has been set up and the screen cleared, false otherwise.
+ */
+bool ssd1306_Console_Init(bool color);
+
+/**
+ * @brief  Appends text to the console. Lines wrap at the right edge, '\n' starts a new line once the next character arrives and '\r' returns to the line start.
+ *         Only the frame buffer is changed, send it with ssd1306_UpdateDirty().
+ * @param  str Pointer to the character array to append.
+ * @param  len The number of characters to append.
+ * @retval true if the text has been appended, false otherwise.
+ */
+bool ssd1306_Console_Write(const char* str, uint16_t len);
+
+/**
+ * @brief  Appends a null terminated string followed by a new line and sends the modified rows.
+ * @param  str The string to print.
+ * @retval true if the line has been printed and sent, false otherwise.
+ */
+bool ssd1306_Console_PrintLine(const char* str);
+
+/**
+ * @brief  Clears the console text and the screen.
+ * @retval true if the console has been cleared, false otherwise.
+ */
+bool ssd1306_Console_Clear(void);
+
+/**
+ * @brief  Renders the whole console again from its line ring, e.g. after something else has drawn over the screen.
+ * @retval true if the console has been redrawn, false otherwise.
+ */
+bool ssd1306_Console_Redraw(void);
+
+#endif // SSD1306_CONSOLE_H
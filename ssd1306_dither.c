@@ -0,0 +1,216 @@
+/*
+*   ssd1306_dither.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_dither.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SSD1306_DITHER_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SSD1306_DITHER_NEON
+#endif
+
+// Bayer 8x8 index matrix (0, 63), scaled to thresholds as index * 4 + 2.
+static const uint8_t bayer8[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+// Error rows, offset by 2 so the diffusion can reach x - 1 and x + 2 without bound checks.
+// Floyd-Steinberg works in place on the first row, Atkinson reaches two rows down and rotates all three.
+static int16_t err_rows[3][SSD1306_DITHER_MAX_WIDTH + 4];
+static uint8_t err_head = 0;
+
+/**
+ * @brief  Sets the page bits of 8 rows against per pixel thresholds. Rows past h are left off.
+ * @param  gray Pointer to the first image row of the page.
+ * @param  w Width of the image.
+ * @param  rows Number of image rows in this page (1, 8).
+ * @param  stride Bytes between image rows.
+ * @param  thresholds Threshold rows, 8 rows of 16 bytes repeating along x.
+ * @param  page Output page bytes.
+ */
+static void ssd1306_Dither_ThresholdPage(const uint8_t* gray, int16_t w, uint8_t rows, uint16_t stride, const uint8_t thresholds[8][16], uint8_t* page){
+    int16_t x = 0;
+#if defined(SSD1306_DITHER_SSE2)
+    for (; x + 16 <= w; x += 16) {
+        __m128i acc = _mm_setzero_si128();
+        for (uint8_t r = 0; r < rows; r++) {
+            __m128i px = _mm_loadu_si128((const __m128i*)(gray + r * stride + x));
+            __m128i th = _mm_loadu_si128((const __m128i*)thresholds[r]);
+            // Unsigned px >= th, then keep the bit of this row.
+            __m128i on = _mm_cmpeq_epi8(_mm_max_epu8(px, th), px);
+            acc = _mm_or_si128(acc, _mm_and_si128(on, _mm_set1_epi8((char)(1 << r))));
+        }
+        _mm_storeu_si128((__m128i*)(page + x), acc);
+    }
+#elif defined(SSD1306_DITHER_NEON)
+    for (; x + 16 <= w; x += 16) {
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (uint8_t r = 0; r < rows; r++) {
+            uint8x16_t on = vcgeq_u8(vld1q_u8(gray + r * stride + x), vld1q_u8(thresholds[r]));
+            acc = vorrq_u8(acc, vandq_u8(on, vdupq_n_u8((uint8_t)(1 << r))));
+        }
+        vst1q_u8(page + x, acc);
+    }
+#endif
+    for (; x < w; x++) {
+        uint8_t bits = 0;
+        for (uint8_t r = 0; r < rows; r++) {
+            if (gray[r * stride + x] >= thresholds[r][x & 15])
+                bits |= (uint8_t)(1 << r);
+        }
+        page[x] = bits;
+    }
+}
+
+/**
+ * @brief  Floyd-Steinberg diffusion of one image row into the page bits of that row, using a single error row.
+ * @param  row Pointer to the image row.
+ * @param  w Width of the image.
+ * @param  bit Bit of the row within its page.
+ * @param  threshold Midpoint between off and on.
+ * @param  page Output page bytes.
+ */
+static void ssd1306_Dither_FloydSteinbergRow(const uint8_t* row, int16_t w, uint8_t bit, uint8_t threshold, uint8_t* page){
+    int16_t* below = &err_rows[0][2];
+    int16_t right = 0;
+    // Errors for the next row at x - 1 and x, written back once the current row has consumed those slots.
+    int16_t next_left = 0, next_here = 0;
+    uint8_t mask = (uint8_t)(1 << bit);
+
+    for (int16_t x = 0; x < w; x++) {
+        int16_t v = (int16_t)(row[x] + right + below[x]);
+        int16_t e;
+        if (v >= threshold) {
+            page[x] |= mask;
+            e = (int16_t)(v - 255);
+        } else {
+            e = v;
+        }
+        // Arithmetic right shifts, the rounding bias is small against the 8 bit range.
+        right = (int16_t)((e * 7) >> 4);
+        below[x - 1] = (int16_t)(next_left + ((e * 3) >> 4));
+        next_left = (int16_t)(next_here + ((e * 5) >> 4));
+        next_here = (int16_t)(e >> 4);
+    }
+    below[w - 1] = next_left;
+}
+
+/**
+ * @brief  Atkinson diffusion of one image row, 1/8 of the error to each of six neighbours.
+ * @param  row Pointer to the image row.
+ * @param  w Width of the image.
+ * @param  bit Bit of the row within its page.
+ * @param  threshold Midpoint between off and on.
+ * @param  page Output page bytes.
+ */
+static void ssd1306_Dither_AtkinsonRow(const uint8_t* row, int16_t w, uint8_t bit, uint8_t threshold, uint8_t* page){
+    int16_t* here = &err_rows[err_head][2];
+    int16_t* next = &err_rows[(err_head + 1) % 3][2];
+    int16_t* next2 = &err_rows[(err_head + 2) % 3][2];
+    uint8_t mask = (uint8_t)(1 << bit);
+
+    for (int16_t x = 0; x < w; x++) {
+        int16_t v = (int16_t)(row[x] + here[x]);
+        int16_t e;
+        if (v >= threshold) {
+            page[x] |= mask;
+            e = (int16_t)(v - 255);
+        } else {
+            e = v;
+        }
+        int16_t part = (int16_t)(e >> 3);
+        here[x + 1] += part;
+        here[x + 2] += part;
+        next[x - 1] += part;
+        next[x] += part;
+        next[x + 1] += part;
+        next2[x] += part;
+    }
+    // The consumed row is reused for the row two below.
+    memset(err_rows[err_head], 0, sizeof(err_rows[0]));
+    err_head = (uint8_t)((err_head + 1) % 3);
+}
+
+/**
+ * @brief  Runs the conversion page by page, handing every finished page to the bitmap or the frame buffer.
+ */
+static bool ssd1306_Dither_Run(const uint8_t* gray, int16_t w, int16_t h, uint16_t stride, ssd1306_dither_mode_t mode, uint8_t threshold,
+                               uint8_t* bitmap, int16_t x0, int16_t y0){
+    if (w <= 0 || w > SSD1306_DITHER_MAX_WIDTH || h <= 0 || stride < (uint16_t)w) {
+        return false;
+    }
+    uint8_t thresholds[8][16];
+    if (mode == SSD1306_DITHER_THRESHOLD) {
+        memset(thresholds, threshold, sizeof(thresholds));
+    } else if (mode == SSD1306_DITHER_BAYER) {
+        for (uint8_t r = 0; r < 8; r++)
+            for (uint8_t c = 0; c < 16; c++)
+                thresholds[r][c] = (uint8_t)(bayer8[r][c & 7] * 4 + 2);
+    } else {
+        memset(err_rows, 0, sizeof(err_rows));
+        err_head = 0;
+    }
+
+    uint8_t local[SSD1306_DITHER_MAX_WIDTH];
+    for (int16_t page_y = 0; page_y < h; page_y += 8) {
+        uint8_t rows = (uint8_t)(h - page_y < 8 ? h - page_y : 8);
+        const uint8_t* src = gray + (size_t)page_y * stride;
+        uint8_t* page = bitmap ? bitmap + (size_t)(page_y / 8) * w : local;
+
+        if (mode == SSD1306_DITHER_THRESHOLD || mode == SSD1306_DITHER_BAYER) {
+            ssd1306_Dither_ThresholdPage(src, w, rows, stride, thresholds, page);
+        } else {
+            memset(page, 0, (size_t)w);
+            for (uint8_t r = 0; r < rows; r++) {
+                if (mode == SSD1306_DITHER_FLOYD_STEINBERG)
+                    ssd1306_Dither_FloydSteinbergRow(src + (size_t)r * stride, w, r, threshold, page);
+                else
+                    ssd1306_Dither_AtkinsonRow(src + (size_t)r * stride, w, r, threshold, page);
+            }
+        }
+        if (!bitmap) {
+            for (int16_t x = 0; x < w; x++)
+                ssd1306_WriteColumn(x0 + x, y0 + page_y, page[x], (uint8_t)(0xFF >> (8 - rows)));
+        }
+    }
+    return true;
+}
+
+bool ssd1306_Dither(const uint8_t* gray, int16_t w, int16_t h, uint16_t stride, ssd1306_dither_mode_t mode, uint8_t threshold, uint8_t* bitmap){
+    if (!bitmap) {
+        return false;
+    }
+    return ssd1306_Dither_Run(gray, w, h, stride, mode, threshold, bitmap, 0, 0);
+}
+
+bool ssd1306_DrawGrayImage(int16_t x, int16_t y, const uint8_t* gray, int16_t w, int16_t h, uint16_t stride, ssd1306_dither_mode_t mode, uint8_t threshold){
+    return ssd1306_Dither_Run(gray, w, h, stride, mode, threshold, NULL, x, y);
+}
+
+bool ssd1306_Dither_Pattern(uint8_t level, ssd1306_pattern_t* pattern){
+    if (level > 64 || !pattern) {
+        return false;
+    }
+    for (uint8_t c = 0; c < 8; c++) {
+        uint8_t column = 0;
+        for (uint8_t r = 0; r < 8; r++) {
+            if (bayer8[r][c] < level) {
+                column |= (uint8_t)(1 << r);
+            }
+        }
+        pattern->columns[c] = column;
+    }
+    return true;
+}
@@ -0,0 +1,59 @@
+/*
+*   ssd1306_dither.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_DITHER_H
+#define SSD1306_DITHER_H
+
+#include "ssd1306.h"
+
+#ifndef SSD1306_DITHER_MAX_WIDTH
+#define SSD1306_DITHER_MAX_WIDTH 128  // Sizes the error rows, wider images are rejected.
+#endif
+
+typedef enum {
+    SSD1306_DITHER_THRESHOLD = 0,   /**< Fixed threshold, no dithering */
+    SSD1306_DITHER_BAYER,           /**< Ordered 8x8 Bayer matrix */
+    SSD1306_DITHER_FLOYD_STEINBERG, /**< Error diffusion over one error row */
+    SSD1306_DITHER_ATKINSON         /**< Error diffusion of 3/4 of the error, keeps more contrast */
+} ssd1306_dither_mode_t;
+
+/**
+ * @brief  Converts an 8 bit grayscale image into a column major, page aligned bitmap as used by ssd1306_DrawBitmap().
+ *         All modes use integer arithmetic only. Threshold and Bayer use SSE2 or NEON when the compiler targets them.
+ * @param  gray Pointer to the grayscale pixels, row major, 0 is black and 255 is white.
+ * @param  w Width of the image in pixels (1, SSD1306_DITHER_MAX_WIDTH).
+ * @param  h Height of the image in pixels.
+ * @param  stride Number of bytes between the starts of two image rows.
+ * @param  mode The dithering method.
+ * @param  threshold Gray level from which a pixel is on, used by the threshold mode and as the error diffusion midpoint.
+ * @param  bitmap Pointer to the output, w * ((h + 7) / 8) bytes.
+ * @retval true if the image has been converted, false otherwise.
+ */
+bool ssd1306_Dither(const uint8_t* gray, int16_t w, int16_t h, uint16_t stride, ssd1306_dither_mode_t mode, uint8_t threshold, uint8_t* bitmap);
+
+/**
+ * @brief  Converts an 8 bit grayscale image straight into the frame buffer, one page at a time, without a bitmap in between.
+ * @param  x Horizontal component of the top left position of the image.
+ * @param  y Vertical component of the top left position of the image.
+ * @param  gray Pointer to the grayscale pixels, row major, 0 is black and 255 is white.
+ * @param  w Width of the image in pixels (1, SSD1306_DITHER_MAX_WIDTH).
+ * @param  h Height of the image in pixels.
+ * @param  stride Number of bytes between the starts of two image rows.
+ * @param  mode The dithering method.
+ * @param  threshold Gray level from which a pixel is on, used by the threshold mode and as the error diffusion midpoint.
+ * @retval true if the image has been drawn, false otherwise.
+ */
+bool ssd1306_DrawGrayImage(int16_t x, int16_t y, const uint8_t* gray, int16_t w, int16_t h, uint16_t stride, ssd1306_dither_mode_t mode, uint8_t threshold);
+
+/**
+ * @brief  Builds the 8x8 Bayer pattern of a gray level, for ssd1306_FillRectPattern() and the other pattern fills.
+ *         Each level turns on the pixels of the level below plus one, so neighbouring levels blend smoothly.
+ * @param  level Number of pixels on out of 64, (0, 64).
+ * @param  pattern Pointer to the pattern to fill.
+ * @retval true if the pattern has been built, false if the level is out of range.
+ */
+bool ssd1306_Dither_Pattern(uint8_t level, ssd1306_pattern_t* pattern);
+
+#endif // SSD1306_DITHER_H
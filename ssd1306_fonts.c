@@ -3,6 +3,7 @@
  * Definitions of FontDef instances and their bitmap data.
  */
 
+#include <stddef.h>
 #include "ssd1306_fonts.h"
 
 // ───────────────────────────────────────────────
@@ -208,4 +209,135 @@ const FontDef Font_5x8 = {
     .data   = Font5x8_Data,
     .width  = 5,
     .height = 8
-};
\ No newline at end of file
+};
+
+// ───────────────────────────────────────────────
+// Latin-1 letters used in German, French and Spanish, the degree sign and the euro sign, in code point order.
+static const uint8_t Font5x8_European_Data[14 * 5] = {
+    // U+00B0 °
+    0x06,0x09,0x09,0x06,0x00,
+    // U+00C4 Ä
+    0x7C,0x13,0x12,0x13,0x7C,
+    // U+00D6 Ö
+    0x3C,0x43,0x42,0x43,0x3C,
+    // U+00DC Ü
+    0x3C,0x41,0x40,0x41,0x3C,
+    // U+00DF ß
+    0x7E,0x01,0x25,0x2A,0x10,
+    // U+00E0 à
+    0x20,0x55,0x56,0x54,0x78,
+    // U+00E4 ä
+    0x20,0x55,0x54,0x55,0x78,
+    // U+00E7 ç
+    0x38,0x44,0xC4,0x44,0x20,
+    // U+00E8 è
+    0x38,0x55,0x56,0x54,0x18,
+    // U+00E9 é
+    0x38,0x54,0x56,0x55,0x18,
+    // U+00F1 ñ
+    0x7E,0x09,0x05,0x06,0x79,
+    // U+00F6 ö
+    0x38,0x45,0x44,0x45,0x38,
+    // U+00FC ü
+    0x3C,0x41,0x40,0x21,0x7C,
+    // U+20AC €
+    0x14,0x3E,0x55,0x55,0x41
+};
+
+// ASCII shares the glyphs of Font_5x8, consecutive code points share a range.
+static const FontRange Font5x8_European_Ranges[] = {
+    { 0x0020, 96, Font5x8_Data },
+    { 0x00B0, 1,  &Font5x8_European_Data[0 * 5] },
+    { 0x00C4, 1,  &Font5x8_European_Data[1 * 5] },
+    { 0x00D6, 1,  &Font5x8_European_Data[2 * 5] },
+    { 0x00DC, 1,  &Font5x8_European_Data[3 * 5] },
+    { 0x00DF, 2,  &Font5x8_European_Data[4 * 5] },
+    { 0x00E4, 1,  &Font5x8_European_Data[6 * 5] },
+    { 0x00E7, 3,  &Font5x8_European_Data[7 * 5] },
+    { 0x00F1, 1,  &Font5x8_European_Data[10 * 5] },
+    { 0x00F6, 1,  &Font5x8_European_Data[11 * 5] },
+    { 0x00FC, 1,  &Font5x8_European_Data[12 * 5] },
+    { 0x20AC, 1,  &Font5x8_European_Data[13 * 5] },
+};
+
+const FontDef Font_5x8_European = {
+    .data        = Font5x8_Data,
+    .width       = 5,
+    .height      = 8,
+    .ranges      = Font5x8_European_Ranges,
+    .range_count = sizeof(Font5x8_European_Ranges) / sizeof(Font5x8_European_Ranges[0])
+};
+
+// ───────────────────────────────────────────────
+// Glyph lookup and UTF-8 decoding.
+
+// Range table and range of the last lookup, text mostly stays within one range.
+static const FontRange* cache_ranges = NULL;
+static uint8_t cache_index = 0;
+
+const uint8_t* ssd1306_Font_Glyph(FontDef font, uint32_t code){
+    if (!font.ranges) {
+        return code >= 32 && code <= 127 ? &font.data[(code - 32) * font.width] : NULL;
+    }
+    // Code points below a range wrap around to large offsets, one compare tests both ends.
+    const FontRange* range = &font.ranges[0];
+    if (code - range->first >= range->count) {
+        uint8_t index = cache_index;
+        if (cache_ranges != font.ranges || index >= font.range_count ||
+            code - font.ranges[index].first >= font.ranges[index].count) {
+            uint8_t lo = 0;
+            uint8_t hi = font.range_count;
+            while (lo < hi) {
+                uint8_t mid = (uint8_t)((lo + hi) / 2);
+                if (code < font.ranges[mid].first) {
+                    hi = mid;
+                } else if (code - font.ranges[mid].first >= font.ranges[mid].count) {
+                    lo = (uint8_t)(mid + 1);
+                } else {
+                    break;
+                }
+            }
+            if (lo >= hi) {
+                return NULL;
+            }
+            index = (uint8_t)((lo + hi) / 2);
+            cache_ranges = font.ranges;
+            cache_index = index;
+        }
+        range = &font.ranges[index];
+    }
+    return &range->data[(code - range->first) * font.width];
+}
+
+uint32_t ssd1306_Utf8_Next(const char* str, uint16_t len, uint16_t* pos){
+    uint8_t lead = (uint8_t)str[(*pos)++];
+    if (lead < 0x80) {
+        return lead;
+    }
+    uint8_t extra;
+    uint32_t code;
+    uint32_t min;
+    if ((lead & 0xE0) == 0xC0) {
+        extra = 1; code = lead & 0x1F; min = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2; code = lead & 0x0F; min = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3; code = lead & 0x07; min = 0x10000;
+    } else {
+        return SSD1306_UTF8_INVALID;
+    }
+    // A sequence cut short consumes only its lead byte, so the next character is still found.
+    uint16_t p = *pos;
+    for (uint8_t i = 0; i < extra; i++, p++) {
+        if (p >= len || ((uint8_t)str[p] & 0xC0) != 0x80) {
+            return SSD1306_UTF8_INVALID;
+        }
+        code = (code << 6) | ((uint8_t)str[p] & 0x3F);
+    }
+    *pos = p;
+    // Overlong forms, surrogates and values past Unicode are not characters.
+    if (code < min || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+        return SSD1306_UTF8_INVALID;
+    }
+    return code;
+}
\ No newline at end of file
@@ -9,10 +9,28 @@
 
 #include <stdint.h>
 
+// Code point returned for malformed UTF-8.
+#define SSD1306_UTF8_INVALID 0xFFFD
+
+/**
+ * @brief Run of consecutive code points of a font, glyphs are width column bytes each with the LSB at the top.
+ */
+typedef struct {
+    uint32_t       first;   /**< First code point of the range */
+    uint16_t       count;   /**< Code points in the range */
+    const uint8_t *data;    /**< Glyph of first, then of the following code points */
+} FontRange;
+
+/**
+ * @brief Fixed width font. Without ranges data holds ASCII 32-127, otherwise the glyphs are found through ranges
+ *        sorted by code point, so a font carries only the characters it needs.
+ */
 typedef struct {
-    const uint8_t *data;
-    uint8_t        width;
-    uint8_t        height;
+    const uint8_t   *data;
+    uint8_t          width;
+    uint8_t          height;
+    const FontRange *ranges;        /**< Sorted, non overlapping ranges, NULL for data from ASCII 32 */
+    uint8_t          range_count;
 } FontDef;
 
 /**
@@ -20,5 +38,28 @@ typedef struct {
  */
 extern const FontDef Font_5x8;
 
+/**
+ * @brief Font_5x8 plus ° Ä Ö Ü ß à ä ç è é ñ ö ü and €.
+ */
+extern const FontDef Font_5x8_European;
+
+/**
+ * @brief  Finds the glyph of a code point. The first range, normally ASCII, is tried first, then the range of the
+ *         last lookup, then a binary search over the ranges.
+ * @param  font The font to look in.
+ * @param  code Unicode code point.
+ * @retval Pointer to font.width column bytes, NULL if the font has no glyph for the code point.
+ */
+const uint8_t* ssd1306_Font_Glyph(FontDef font, uint32_t code);
+
+/**
+ * @brief  Decodes the UTF-8 character at *pos and moves *pos past it.
+ * @param  str Pointer to the character array.
+ * @param  len The length of the character array, *pos must be below it.
+ * @param  pos Byte offset of the character, advanced by the bytes used.
+ * @retval Code point, SSD1306_UTF8_INVALID for malformed, overlong or truncated sequences.
+ */
+uint32_t ssd1306_Utf8_Next(const char* str, uint16_t len, uint16_t* pos);
+
 
 #endif // SSD1306_FONTS_H
\ No newline at end of file
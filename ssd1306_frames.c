@@ -0,0 +1,80 @@
+/*
+*   ssd1306_frames.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_frames.h"
+#include <string.h>
+
+// The middle slot holds a buffer index and a flag telling the flusher the buffer has not been taken yet.
+#define SSD1306_FRAMES_FRESH 0x80
+#define SSD1306_FRAMES_INDEX 0x03
+
+// GCC and Clang atomic builtins, available on the ARM, Xtensa and host toolchains the driver is built with.
+#define SSD1306_ATOMIC_EXCHANGE(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+#define SSD1306_ATOMIC_LOAD(ptr)            __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define SSD1306_ATOMIC_STORE(ptr, value)    __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+
+bool ssd1306_Frames_Init(ssd1306_frames_t* frames, uint8_t* storage){
+    if (!frames || !storage) {
+        return false;
+    }
+    memset(storage, 0, 3 * SSD1306_FRAME_SIZE);
+    for (uint8_t i = 0; i < 3; i++) {
+        frames->buffers[i] = &storage[i * SSD1306_FRAME_SIZE];
+    }
+    frames->back = 0;
+    frames->middle = 1;
+    frames->front = 2;
+    frames->front_pending = false;
+    memset(&frames->stats, 0, sizeof(frames->stats));
+    return true;
+}
+
+uint8_t* ssd1306_Frames_Back(ssd1306_frames_t* frames){
+    return frames->buffers[frames->back];
+}
+
+bool ssd1306_Frames_Publish(ssd1306_frames_t* frames){
+    // The release half of the exchange makes the frame content visible before its index.
+    uint8_t old = SSD1306_ATOMIC_EXCHANGE(&frames->middle, (uint8_t)(frames->back | SSD1306_FRAMES_FRESH));
+    frames->back = old & SSD1306_FRAMES_INDEX;
+    SSD1306_ATOMIC_STORE(&frames->stats.published, frames->stats.published + 1);
+    if (old & SSD1306_FRAMES_FRESH) {
+        SSD1306_ATOMIC_STORE(&frames->stats.dropped, frames->stats.dropped + 1);
+        return false;
+    }
+    return true;
+}
+
+const uint8_t* ssd1306_Frames_Take(ssd1306_frames_t* frames){
+    // Only the flusher clears the flag, a frame published after this check is simply taken instead.
+    if (!(SSD1306_ATOMIC_LOAD(&frames->middle) & SSD1306_FRAMES_FRESH)) {
+        return NULL;
+    }
+    uint8_t old = SSD1306_ATOMIC_EXCHANGE(&frames->middle, frames->front);
+    frames->front = old & SSD1306_FRAMES_INDEX;
+    SSD1306_ATOMIC_STORE(&frames->stats.taken, frames->stats.taken + 1);
+    return frames->buffers[frames->front];
+}
+
+bool ssd1306_Frames_Flush(ssd1306_frames_t* frames){
+    // The front buffer is read by the transfer in flight and must not be given back before it completes.
+    if (!ssd1306_platform_is_dma_done()) {
+        return false;
+    }
+    if (ssd1306_Frames_Take(frames)) {
+        frames->front_pending = true;
+    }
+    if (!frames->front_pending || !ssd1306_SendFrame(frames->buffers[frames->front])) {
+        return false;
+    }
+    frames->front_pending = false;
+    return true;
+}
+
+void ssd1306_Frames_GetStats(const ssd1306_frames_t* frames, ssd1306_frames_stats_t* stats){
+    stats->published = SSD1306_ATOMIC_LOAD(&frames->stats.published);
+    stats->dropped = SSD1306_ATOMIC_LOAD(&frames->stats.dropped);
+    stats->taken = SSD1306_ATOMIC_LOAD(&frames->stats.taken);
+}
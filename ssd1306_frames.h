@@ -0,0 +1,105 @@
+/*
+*   ssd1306_frames.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_FRAMES_H
+#define SSD1306_FRAMES_H
+
+#include "ssd1306.h"
+
+/*
+ * Lock free frame handoff between one rendering task and one flushing task, as a triple buffer. The renderer always
+ * owns a back buffer to draw into and never waits, the flusher always gets the newest complete frame. A frame that is
+ * published before the flusher took the previous one replaces it, the older frame is dropped instead of queued.
+ * Both sides only swap buffer indices with single atomic exchanges, so the tasks may run on different cores or be
+ * preempted anywhere. There must be exactly one renderer and one flusher.
+ *
+ * Renderer task, drawing with the regular functions through a single tile canvas:
+ *
+ *   ssd1306_canvas_t canvas = { .tiles_x = 1, .tiles_y = 1 };
+ *   for (;;) {
+ *       canvas.buffer = ssd1306_Frames_Back(&frames);
+ *       ssd1306_SetTarget(&canvas);
+ *       ssd1306_Clear();
+ *       draw_scene();
+ *       ssd1306_SetTarget(NULL);
+ *       ssd1306_Frames_Publish(&frames);
+ *   }
+ *
+ * Flusher task:
+ *
+ *   for (;;) {
+ *       ssd1306_Frames_Flush(&frames);
+ *       vTaskDelay(1);
+ *   }
+ */
+
+#define SSD1306_FRAME_SIZE 1024
+
+typedef struct {
+    uint32_t published; /**< Frames published by the renderer */
+    uint32_t dropped;   /**< Published frames replaced by a newer one before the flusher took them */
+    uint32_t taken;     /**< Frames taken by the flusher */
+} ssd1306_frames_stats_t;
+
+/**
+ * @brief Triple buffer state. The back index belongs to the renderer, the front index to the flusher, and the
+ *        middle slot is only accessed through atomic exchanges.
+ */
+typedef struct {
+    uint8_t* buffers[3];
+    uint8_t  back;          /**< Buffer the renderer draws into */
+    uint8_t  middle;        /**< Last published buffer, bit 7 set until the flusher takes it */
+    uint8_t  front;         /**< Buffer the flusher sends from */
+    bool     front_pending; /**< The front buffer has been taken but not sent yet */
+    ssd1306_frames_stats_t stats;
+} ssd1306_frames_t;
+
+/**
+ * @brief  Sets up the triple buffer over caller provided storage and clears it.
+ * @param  frames Pointer to the handoff state.
+ * @param  storage Pointer to 3 * SSD1306_FRAME_SIZE bytes.
+ * @retval true if the handoff has been set up, false otherwise.
+ */
+bool ssd1306_Frames_Init(ssd1306_frames_t* frames, uint8_t* storage);
+
+/**
+ * @brief  Provides the buffer the renderer draws the next frame into, in the page layout of ssd1306_SendFrame().
+ *         Its content is a frame two or more frames old, the renderer is expected to redraw it fully. Renderer only.
+ * @param  frames Pointer to the handoff state.
+ * @retval Pointer to SSD1306_FRAME_SIZE bytes, valid until the next ssd1306_Frames_Publish().
+ */
+uint8_t* ssd1306_Frames_Back(ssd1306_frames_t* frames);
+
+/**
+ * @brief  Publishes the back buffer as the newest complete frame and takes a new back buffer. Renderer only, never blocks.
+ * @param  frames Pointer to the handoff state.
+ * @retval true if the frame has been queued, false if it replaced a frame the flusher had not taken, which is dropped.
+ */
+bool ssd1306_Frames_Publish(ssd1306_frames_t* frames);
+
+/**
+ * @brief  Takes the newest complete frame if one has been published since the last take. Flusher only, never blocks.
+ *         The frame stays valid and unmodified until the next successful take.
+ * @param  frames Pointer to the handoff state.
+ * @retval Pointer to the frame, NULL if no new frame has been published.
+ */
+const uint8_t* ssd1306_Frames_Take(ssd1306_frames_t* frames);
+
+/**
+ * @brief  Sends the newest complete frame with ssd1306_SendFrame() once the previous transfer has completed. A frame that
+ *         cannot be started is retried by the next call unless a newer one has been published. Flusher only.
+ * @param  frames Pointer to the handoff state.
+ * @retval true if a transfer has been started, false if there was nothing new to send or the bus is busy.
+ */
+bool ssd1306_Frames_Flush(ssd1306_frames_t* frames);
+
+/**
+ * @brief  Provides the handoff counters, each one is written by a single side and may lag the other side by a frame.
+ * @param  frames Pointer to the handoff state.
+ * @param  stats Pointer to the structure to fill.
+ */
+void ssd1306_Frames_GetStats(const ssd1306_frames_t* frames, ssd1306_frames_stats_t* stats);
+
+#endif // SSD1306_FRAMES_H
@@ -0,0 +1,185 @@
+/*
+*   ssd1306_gray.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_gray.h"
+#include <string.h>
+#include <stdlib.h>
+
+#define GRAY_WIDTH   128
+#define GRAY_HEIGHT  64
+#define GRAY_PLANE_SIZE (GRAY_WIDTH * GRAY_HEIGHT / 8)
+
+static uint8_t planes[SSD1306_GRAY_MAX_BITS][GRAY_PLANE_SIZE];
+static uint8_t plane_bits = 0;
+
+// Plane shown in each slot. The heavier planes are spread out so no plane stays dark for long.
+static const uint8_t schedule_2bit[] = { 1, 0, 1 };
+static const uint8_t schedule_3bit[] = { 2, 1, 2, 0, 2, 1, 2 };
+static const uint8_t* schedule = NULL;
+static uint8_t schedule_len = 0;
+static uint8_t slot = 0;
+static int8_t shown_plane = -1;
+
+static uint32_t slot_period_us = 0;
+static uint32_t next_slot_us = 0;
+static bool started = false;
+static uint32_t window_start_us = 0;
+static uint32_t window_slots = 0;
+static ssd1306_gray_stats_t stats;
+
+bool ssd1306_Gray_Init(uint8_t bits, uint32_t slot_rate_hz){
+    if (bits < 2 || bits > SSD1306_GRAY_MAX_BITS || slot_rate_hz == 0) {
+        return false;
+    }
+    plane_bits = bits;
+    schedule = bits == 2 ? schedule_2bit : schedule_3bit;
+    schedule_len = bits == 2 ? sizeof(schedule_2bit) : sizeof(schedule_3bit);
+    slot = 0;
+    shown_plane = -1;
+    slot_period_us = 1000000UL / slot_rate_hz;
+    started = false;
+    memset(&stats, 0, sizeof(stats));
+    return ssd1306_Gray_Clear(0);
+}
+
+bool ssd1306_Gray_Tick(uint32_t now_us){
+    if (!started) {
+        started = true;
+        next_slot_us = now_us;
+        window_start_us = now_us;
+        window_slots = 0;
+    }
+    if ((int32_t)(now_us - next_slot_us) < 0) {
+        return false;
+    }
+    if (!ssd1306_platform_is_dma_done()) {
+        return false;
+    }
+
+    uint8_t plane = schedule[slot];
+    if ((int8_t)plane == shown_plane) {
+        // The plane is already on screen, the slot only needs to last.
+        stats.planes_skipped++;
+    } else {
+        if (!ssd1306_SendFrame(planes[plane])) {
+            return false;
+        }
+        shown_plane = (int8_t)plane;
+        stats.planes_sent++;
+    }
+    slot = (uint8_t)((slot + 1) % schedule_len);
+
+    // Slots are paced against the schedule, a late slot shortens the next wait instead of drifting.
+    next_slot_us += slot_period_us;
+    if ((int32_t)(now_us - next_slot_us) >= 0) {
+        stats.slots_late++;
+        next_slot_us = now_us + slot_period_us;
+    }
+
+    window_slots++;
+    uint32_t elapsed = now_us - window_start_us;
+    if (elapsed >= 1000000UL) {
+        stats.plane_rate_hz = (uint32_t)((uint64_t)window_slots * 1000000UL / elapsed);
+        stats.cycle_rate_hz = stats.plane_rate_hz / schedule_len;
+        stats.flicker_margin_pct = (int32_t)(stats.cycle_rate_hz * 100 / SSD1306_GRAY_FLICKER_HZ) - 100;
+        window_start_us = now_us;
+        window_slots = 0;
+    }
+    return true;
+}
+
+void ssd1306_Gray_GetStats(ssd1306_gray_stats_t* out){
+    *out = stats;
+}
+
+bool ssd1306_Gray_Clear(uint8_t level){
+    for (uint8_t k = 0; k < plane_bits; k++) {
+        memset(planes[k], ((level >> k) & 1) ? 0xFF : 0x00, GRAY_PLANE_SIZE);
+    }
+    shown_plane = -1;
+    return true;
+}
+
+/**
+ * @brief  Writes the masked bits of one page byte in every plane according to the gray level.
+ */
+static inline void ssd1306_Gray_PutByte(uint16_t index, uint8_t mask, uint8_t level){
+    for (uint8_t k = 0; k < plane_bits; k++) {
+        if ((level >> k) & 1)
+            planes[k][index] |= mask;
+        else
+            planes[k][index] &= (uint8_t)~mask;
+    }
+}
+
+bool ssd1306_Gray_DrawPixel(int16_t x, int16_t y, uint8_t level){
+    if (x < 0 || x >= GRAY_WIDTH || y < 0 || y >= GRAY_HEIGHT) {
+        return false;
+    }
+    ssd1306_Gray_PutByte((uint16_t)(x + (y / 8) * GRAY_WIDTH), (uint8_t)(1 << (y % 8)), level);
+    shown_plane = -1;
+    return true;
+}
+
+bool ssd1306_Gray_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t level){
+    int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy, e2;
+
+    while (1) {
+        ssd1306_Gray_DrawPixel(x0, y0, level);
+        if (x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+    return true;
+}
+
+bool ssd1306_Gray_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t level){
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > GRAY_WIDTH) w = GRAY_WIDTH - x;
+    if (y + h > GRAY_HEIGHT) h = GRAY_HEIGHT - y;
+    if (w <= 0 || h <= 0) {
+        return false;
+    }
+    for (int16_t page = y / 8; page <= (y + h - 1) / 8; page++) {
+        // Rows of the rectangle within this page.
+        int16_t top = page * 8 > y ? page * 8 : y;
+        int16_t bottom = page * 8 + 7 < y + h - 1 ? page * 8 + 7 : y + h - 1;
+        uint8_t mask = (uint8_t)((0xFF << (top & 7)) & (0xFF >> (7 - (bottom & 7))));
+        for (int16_t col = x; col < x + w; col++) {
+            ssd1306_Gray_PutByte((uint16_t)(col + page * GRAY_WIDTH), mask, level);
+        }
+    }
+    shown_plane = -1;
+    return true;
+}
+
+bool ssd1306_Gray_WriteChar(int16_t x, int16_t y, char ch, FontDef font, uint8_t level){
+    const uint8_t* glyph = ssd1306_Font_Glyph(font, (uint8_t)ch);
+    if (!glyph) {
+        return false;
+    }
+    // Glyphs are stored column by column, one byte per column with the LSB at the top. Shifted to y a column spans
+    // at most two pages, each written as one masked byte.
+    uint8_t rows = font.height >= 8 ? 0xFF : (uint8_t)((1u << font.height) - 1);
+    int16_t page = (int16_t)((y >= 0 ? y : y - 7) / 8);
+    uint8_t shift = (uint8_t)(y - page * 8);
+    for (uint8_t col = 0; col < font.width; col++) {
+        int16_t px = x + col;
+        uint16_t bits = (uint16_t)((glyph[col] & rows) << shift);
+        if (px < 0 || px >= GRAY_WIDTH) {
+            continue;
+        }
+        if ((bits & 0xFF) && page >= 0 && page < GRAY_HEIGHT / 8)
+            ssd1306_Gray_PutByte((uint16_t)(px + page * GRAY_WIDTH), (uint8_t)bits, level);
+        if ((bits >> 8) && page + 1 >= 0 && page + 1 < GRAY_HEIGHT / 8)
+            ssd1306_Gray_PutByte((uint16_t)(px + (page + 1) * GRAY_WIDTH), (uint8_t)(bits >> 8), level);
+    }
+    shown_plane = -1;
+    return true;
+}
@@ -0,0 +1,103 @@
+/*
+*   ssd1306_gray.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_GRAY_H
+#define SSD1306_GRAY_H
+
+#include "ssd1306.h"
+
+#ifndef SSD1306_GRAY_MAX_BITS
+#define SSD1306_GRAY_MAX_BITS   3   // Each bit of gray depth costs one 1 KB bitplane.
+#endif
+
+#ifndef SSD1306_GRAY_FLICKER_HZ
+#define SSD1306_GRAY_FLICKER_HZ 50  // Full gray cycles per second below which flicker becomes visible.
+#endif
+
+/**
+ * @brief Throughput of the plane cycling, as measured by ssd1306_Gray_Tick().
+ */
+typedef struct {
+    uint32_t planes_sent;        /**< Plane transfers started */
+    uint32_t planes_skipped;     /**< Slots that showed the same plane again without a transfer */
+    uint32_t slots_late;         /**< Slots that started late because the previous transfer was still running */
+    uint32_t plane_rate_hz;      /**< Achieved plane slots per second */
+    uint32_t cycle_rate_hz;      /**< Achieved full gray cycles per second */
+    int32_t  flicker_margin_pct; /**< Cycle rate above (positive) or below (negative) SSD1306_GRAY_FLICKER_HZ in percent */
+} ssd1306_gray_stats_t;
+
+/**
+ * @brief  Sets up frame rate modulation grayscale. Bitplane k is shown for 2^k of every 2^bits - 1 slots,
+ *         so a pixel's perceived brightness follows its gray level.
+ * @param  bits Gray depth, 2 for 4 levels or 3 for 8 levels.
+ * @param  slot_rate_hz Target number of plane slots per second. Each slot is one full frame transfer.
+ * @retval true if the mode has been set up, false otherwise.
+ */
+bool ssd1306_Gray_Init(uint8_t bits, uint32_t slot_rate_hz);
+
+/**
+ * @brief  Paces the plane cycling, call it as often as possible from the main loop or a timer.
+ *         Starts the next plane through ssd1306_SendFrame() once its slot is due and the previous transfer is done.
+ * @param  now_us Current time in microseconds, wrapping is handled.
+ * @retval true if a slot has started, false if nothing was due or the bus was busy.
+ */
+bool ssd1306_Gray_Tick(uint32_t now_us);
+
+/**
+ * @brief  Provides the achieved plane rate and flicker margin.
+ * @param  stats Pointer to the structure to fill.
+ */
+void ssd1306_Gray_GetStats(ssd1306_gray_stats_t* stats);
+
+/**
+ * @brief  Fills all the bitplanes with one gray level.
+ * @param  level Gray level (0, 2^bits - 1).
+ * @retval true if the planes have been filled, false otherwise.
+ */
+bool ssd1306_Gray_Clear(uint8_t level);
+
+/**
+ * @brief  Draws a pixel in a gray level.
+ * @param  x Horizontal component of the position of the pixel.
+ * @param  y Vertical component of the position of the pixel.
+ * @param  level Gray level (0, 2^bits - 1), 0 is off.
+ * @retval true if the pixel has been drawn, false otherwise.
+ */
+bool ssd1306_Gray_DrawPixel(int16_t x, int16_t y, uint8_t level);
+
+/**
+ * @brief  Draws a line in a gray level.
+ * @param  x0 Horizontal component of the first point of the line.
+ * @param  y0 Vertical component of the first point of the line.
+ * @param  x1 Horizontal component of the end point of the line.
+ * @param  y1 Vertical component of the end point of the line.
+ * @param  level Gray level (0, 2^bits - 1).
+ * @retval true if the line has been drawn, false otherwise.
+ */
+bool ssd1306_Gray_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t level);
+
+/**
+ * @brief  Draws a filled rectangle in a gray level, a whole page byte at a time.
+ * @param  x Horizontal coordinate of the top‑left corner.
+ * @param  y Vertical coordinate of the top‑left corner.
+ * @param  w Width of the rectangle in pixels.
+ * @param  h Height of the rectangle in pixels.
+ * @param  level Gray level (0, 2^bits - 1).
+ * @retval true if the rectangle has been drawn, false otherwise.
+ */
+bool ssd1306_Gray_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t level);
+
+/**
+ * @brief  Draws a character of the font in a gray level, background pixels are left untouched.
+ * @param  x The horizontal component of the top left position of the character.
+ * @param  y The vertical component of the top left position of the character.
+ * @param  ch The character to be displayed.
+ * @param  font The font the character needs to be displayed in, glyph columns are page bytes.
+ * @param  level Gray level (0, 2^bits - 1).
+ * @retval true if the character has been drawn, false otherwise.
+ */
+bool ssd1306_Gray_WriteChar(int16_t x, int16_t y, char ch, FontDef font, uint8_t level);
+
+#endif // SSD1306_GRAY_H
@@ -0,0 +1,50 @@
+/*
+*   ssd1306_lvgl.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_lvgl.h"
+
+#ifdef SSD1306_USE_LVGL
+
+#define LVGL_WIDTH   128
+#define LVGL_HEIGHT  64
+#define LVGL_PALETTE_SIZE 8 // I1 buffers start with two ARGB8888 palette entries.
+
+LV_ATTRIBUTE_MEM_ALIGN static uint8_t draw_buf[LVGL_PALETTE_SIZE + (LVGL_WIDTH / 8) * SSD1306_LVGL_BUFFER_ROWS];
+
+/**
+ * @brief  Widens invalidated areas to whole pages, so every flush covers the page bytes it sends.
+ */
+static void ssd1306_Lvgl_Rounder(lv_event_t* e){
+    lv_area_t* area = lv_event_get_invalidated_area(e);
+    area->y1 &= ~7;
+    area->y2 |= 7;
+}
+
+lv_display_t* ssd1306_Lvgl_Create(void){
+    lv_display_t* disp = lv_display_create(LVGL_WIDTH, LVGL_HEIGHT);
+    if (!disp) {
+        return NULL;
+    }
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, ssd1306_Lvgl_Flush);
+    lv_display_add_event_cb(disp, ssd1306_Lvgl_Rounder, LV_EVENT_INVALIDATE_AREA, NULL);
+    return disp;
+}
+
+void ssd1306_Lvgl_Flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map){
+    int16_t x = (int16_t)area->x1;
+    int16_t y = (int16_t)area->y1;
+    int16_t w = (int16_t)lv_area_get_width(area);
+    int16_t h = (int16_t)lv_area_get_height(area);
+    uint16_t stride = (uint16_t)lv_draw_buf_width_to_stride((uint32_t)w, LV_COLOR_FORMAT_I1);
+
+    ssd1306_WriteRowBitmap(x, y, px_map + LVGL_PALETTE_SIZE, w, h, stride);
+    // A busy bus leaves the area marked as modified, the next ssd1306_UpdateDirty() sends it.
+    ssd1306_UpdateArea(x, y, w, h);
+    lv_display_flush_ready(disp);
+}
+
+#endif // SSD1306_USE_LVGL
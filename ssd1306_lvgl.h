@@ -0,0 +1,38 @@
+/*
+*   ssd1306_lvgl.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_LVGL_H
+#define SSD1306_LVGL_H
+
+#include "ssd1306.h"
+
+// LVGL 9 display driver. Define SSD1306_USE_LVGL in the build that has LVGL on its include path.
+#ifdef SSD1306_USE_LVGL
+
+#include "lvgl.h"
+
+#ifndef SSD1306_LVGL_BUFFER_ROWS
+#define SSD1306_LVGL_BUFFER_ROWS 16 // Rows LVGL renders per flush, a multiple of 8 keeps the flushes page aligned.
+#endif
+
+/**
+ * @brief  Creates an LVGL display for the panel: 128x64, I1 color format, partial rendering into a static buffer.
+ *         The panel must have been set up with ssd1306_Init().
+ * @retval The LVGL display, NULL if it could not be created.
+ */
+lv_display_t* ssd1306_Lvgl_Create(void);
+
+/**
+ * @brief  LVGL flush callback. The I1 area is transposed into the frame buffer and sent through a column and page
+ *         address window covering exactly that area, there is no per pixel copy.
+ * @param  disp The LVGL display.
+ * @param  area The rendered area in screen coordinates.
+ * @param  px_map The rendered pixels, an 8 byte palette followed by MSB first rows.
+ */
+void ssd1306_Lvgl_Flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
+
+#endif // SSD1306_USE_LVGL
+
+#endif // SSD1306_LVGL_H
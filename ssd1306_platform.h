@@ -15,12 +15,14 @@ extern "C" {
 #endif
 
 /**
- * @brief Ensure that only one of the following three defines are uncommented. 
+ * @brief Ensure that only one of the following four defines are uncommented. 
  *        This is to select which platform to use the driver on.
+ *        SSD1306_USE_HOST is the simulated display used by the host build (CMake), benchmarks and tests.
  */
 // #define SSD1306_USE_STM32
 // #define SSD1306_USE_ESP_ARDUINO
 // #define SSD1306_USE_ESP_IDF
+// #define SSD1306_USE_HOST
 
 /**
  * @brief Platform-specific context for SSD1306 driver
@@ -28,6 +30,7 @@ extern "C" {
  * Members are only valid under the matching macro:
  *  - SSD1306_USE_STM32: hi2c, hdma_tx, i2c_addr
  *  - SSD1306_USE_ESP_ARDUINO: wire, i2c_addr
+ *  - SSD1306_USE_HOST: i2c_addr
  */
 typedef struct {
 #ifdef SSD1306_USE_STM32
@@ -46,12 +49,17 @@ typedef struct {
     uint8_t           i2c_addr; /**< 7‑bit I2C address */
 #endif
 
+#ifdef SSD1306_USE_HOST
+    uint8_t           i2c_addr; /**< 7‑bit I2C address */
+#endif
+
 } ssd1306_platform_t;
 
 /**
  * @brief Initialize the platform context
  * On STM32: pass hi2c, hdma_tx, and (7‑bit) addr.
  * On ESP Arduino: pass wire and (7‑bit) addr.
+ * On the host: pass the (7‑bit) addr, the simulated display is reset.
  */
 void ssd1306_platform_init(
                             #ifdef SSD1306_USE_STM32
@@ -67,13 +75,161 @@ void ssd1306_platform_init(
                             uint8_t addr
                             );
 
+/**
+ * @brief Number of panels the platform keeps a context for, panel 0 is the one set up by ssd1306_platform_init().
+ */
+#ifndef SSD1306_MAX_PANELS
+#define SSD1306_MAX_PANELS 4
+#endif
+
+/**
+ * @brief Initialize the context of one panel of a multi panel display, the arguments are those of ssd1306_platform_init().
+ * Panels on the same bus need different addresses. Transfers on separate buses run concurrently where the
+ * platform transfers in the background (STM32 DMA, the host), the ESP backends block and send one panel at a time.
+ */
+void ssd1306_platform_init_panel(
+                            uint8_t panel,
+                            #ifdef SSD1306_USE_STM32
+                                I2C_HandleTypeDef *hi2c,
+                                DMA_HandleTypeDef *hdma_tx,
+                            #endif
+                            #ifdef SSD1306_USE_ESP_ARDUINO
+                                TwoWire *wire,
+                            #endif
+                            #ifdef SSD1306_USE_ESP_IDF
+                                i2c_port_t i2c_port,
+                            #endif
+                            uint8_t addr
+                            );
+
+/**
+ * @brief  Routes the following platform calls to a panel, ssd1306_platform_init() selects panel 0.
+ * @param  panel Panel set up by ssd1306_platform_init_panel().
+ * @retval false if the panel is not set up, the selection is unchanged.
+ */
+bool ssd1306_platform_select(uint8_t panel);
+
+/**
+ * @brief Provides the panel the platform calls go to.
+ */
+uint8_t ssd1306_platform_selected(void);
+
 bool ssd1306_platform_write_command(uint8_t cmd);
 bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size);
 bool ssd1306_platform_write_data(const uint8_t *data, uint16_t size);
 bool ssd1306_platform_start_data_dma(const uint8_t *data, uint16_t size);
+
+/**
+ * @brief Starts one transaction carrying both commands and data, through DMA where the platform supports it.
+ * The stream is sent after the address as is: pairs of a Co = 1 control byte (0x80) and a command byte, then a
+ * 0x40 control byte followed by data bytes up to the end. Platforms that cannot send it in one transaction split it.
+ */
+bool ssd1306_platform_start_stream_dma(const uint8_t *stream, uint16_t size);
 bool ssd1306_platform_is_dma_done();
 bool ssd1306_platform_delay_us(uint32_t us);
 
+#ifdef SSD1306_USE_HOST
+
+// Simulated display, host only.
+
+/**
+ * @brief Kind of a recorded transaction, one per platform call.
+ */
+typedef enum {
+    SSD1306_HOST_COMMAND = 0,   /**< ssd1306_platform_write_command() */
+    SSD1306_HOST_MULTI_COMMAND, /**< ssd1306_platform_write_multi_command() */
+    SSD1306_HOST_DATA,          /**< ssd1306_platform_write_data() */
+    SSD1306_HOST_DATA_DMA,      /**< ssd1306_platform_start_data_dma() */
+    SSD1306_HOST_STREAM         /**< ssd1306_platform_start_stream_dma(), size counts the control bytes after the first */
+} ssd1306_host_kind_t;
+
+typedef struct {
+    ssd1306_host_kind_t kind;
+    uint16_t            size;   /**< Payload bytes, without address and control bytes */
+    uint8_t             panel;  /**< Panel selected for the call */
+} ssd1306_host_transaction_t;
+
+typedef struct {
+    uint32_t transactions;      /**< Platform write calls */
+    uint32_t command_bytes;     /**< Command bytes including arguments, and the control bytes inside streams */
+    uint32_t data_bytes;        /**< GDDRAM data bytes */
+    uint32_t delay_us;          /**< Time requested through ssd1306_platform_delay_us() */
+    uint32_t log_dropped;       /**< Transactions that did not fit in the log */
+} ssd1306_host_stats_t;
+
+#ifndef SSD1306_HOST_LOG_SIZE
+#define SSD1306_HOST_LOG_SIZE 4096
+#endif
+
+/**
+ * @brief The queries below act on the panel selected by ssd1306_platform_select(), the counters and the log cover all panels.
+ */
+
+/**
+ * @brief Provides the emulated GDDRAM, 8 pages of 128 column bytes as addressed by the controller.
+ */
+const uint8_t* ssd1306_host_gddram(void);
+
+/**
+ * @brief Sends one blocking transaction to the selected panel the way a hardware backend puts it on the wire, for
+ *        checking the framing of a backend. It is recorded like a stream.
+ * @param control The control byte after the address.
+ * @param payload The bytes after the control byte, including any further control bytes.
+ * @param size Number of bytes in the payload.
+ * @retval false if the bus is busy or the framing is not what the driver sends: the control byte is not 0x00, 0x40
+ *         or 0x80, a Co = 1 pair is followed by anything but another pair or 0x40, or a Co = 1 control byte ends the
+ *         transaction. Nothing is applied then.
+ */
+bool ssd1306_host_write_frame(uint8_t control, const uint8_t* payload, uint16_t size);
+
+/**
+ * @brief Provides the emulated display start line (0, 63).
+ */
+uint8_t ssd1306_host_start_line(void);
+
+/**
+ * @brief Renders what the panel shows, applying start line, segment remap, COM scan direction, inversion and display on/off.
+ * @param pixels Pointer to 128 * 64 bytes, row major, 1 for a lit pixel.
+ */
+void ssd1306_host_render(uint8_t* pixels);
+
+/**
+ * @brief Provides the transaction counters since the last reset.
+ */
+void ssd1306_host_get_stats(ssd1306_host_stats_t* stats);
+
+/**
+ * @brief Resets the transaction counters and the transaction log.
+ */
+void ssd1306_host_reset_stats(void);
+
+/**
+ * @brief Provides the transactions recorded since the last reset.
+ * @param count Set to the number of recorded transactions.
+ */
+const ssd1306_host_transaction_t* ssd1306_host_log(uint32_t* count);
+
+/**
+ * @brief Sets the simulated time used to complete DMA transfers.
+ * @param now_us Simulated time in microseconds.
+ */
+void ssd1306_host_set_time_us(uint32_t now_us);
+
+/**
+ * @brief Sets the wire time a DMA transfer keeps ssd1306_platform_is_dma_done() false for, 0 to complete instantly.
+ * @param bus_hz I2C clock used to derive the transfer time.
+ */
+void ssd1306_host_set_dma_bus_hz(uint32_t bus_hz);
+
+/**
+ * @brief Puts a panel on a simulated bus, ssd1306_platform_init_panel() gives every panel a bus of its own.
+ * @param panel Panel (0, SSD1306_MAX_PANELS - 1).
+ * @param bus Bus (0, SSD1306_MAX_PANELS - 1), panels on one bus wait for each other's transfers.
+ */
+void ssd1306_host_set_panel_bus(uint8_t panel, uint8_t bus);
+
+#endif // SSD1306_USE_HOST
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,20 +4,44 @@
 #include <Wire.h>
 #include <Arduino.h>
 
-static ssd1306_platform_t ctx;
+static ssd1306_platform_t panels[SSD1306_MAX_PANELS];
+static ssd1306_platform_t *ctx = &panels[0];
+
+void ssd1306_platform_init_panel(uint8_t panel, TwoWire *wire, uint8_t addr)
+{
+    if (panel >= SSD1306_MAX_PANELS) {
+        return;
+    }
+    panels[panel].wire = wire;
+    panels[panel].i2c_addr = static_cast<uint8_t>(addr); // store 7-bit I2C address
+}
 
 void ssd1306_platform_init(TwoWire *wire, uint8_t addr)
 {
-    ctx.wire = wire;
-    ctx.i2c_addr = static_cast<uint8_t>(addr); // store 7-bit I2C address
+    ssd1306_platform_init_panel(0, wire, addr);
+    ctx = &panels[0];
+}
+
+bool ssd1306_platform_select(uint8_t panel)
+{
+    if (panel >= SSD1306_MAX_PANELS || panels[panel].wire == nullptr) {
+        return false;
+    }
+    ctx = &panels[panel];
+    return true;
+}
+
+uint8_t ssd1306_platform_selected(void)
+{
+    return static_cast<uint8_t>(ctx - panels);
 }
 
 bool ssd1306_platform_write_command(uint8_t cmd)
 {
-    ctx.wire->beginTransmission(ctx.i2c_addr);
-    ctx.wire->write(0x00);  // Control byte for command
-    ctx.wire->write(cmd);
-    return ctx.wire->endTransmission() == 0;
+    ctx->wire->beginTransmission(ctx->i2c_addr);
+    ctx->wire->write(0x00);  // Control byte for command
+    ctx->wire->write(cmd);
+    return ctx->wire->endTransmission() == 0;
 }
 
 bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size)
@@ -25,31 +49,13 @@ bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size)
     if (size == 0){
         return true;
     }
-    uint8_t control = 0x00;
-    uint16_t sent = 0;
-
-    // First byte with control byte 0x00.
-    ctx.wire->beginTransmission(ctx.i2c_addr);
-    ctx.wire->write(control);
-    control = 0x80;
-    ctx.wire->write(cmd[sent++]);
-    ctx.wire->endTransmission((size > 1 ? false : true) != 0);
-    while (sent < size) {
-        ctx.wire->beginTransmission(ctx.i2c_addr);
-        ctx.wire->write(control);
-
-        // Send up to 16 bytes at a time for compatibility
-        uint16_t chunk = (size - sent > 16) ? 16 : (size - sent);
-        ctx.wire->write(cmd + sent, chunk);
-        sent += chunk;
-
-        if (ctx.wire->endTransmission(sent < size) != 0) {
-            return false;
-        }
-    }
 
-    // Final STOP
-    return true;
+    // One transaction under Co = 0, D/C# = 0, the command lists of the driver fit the Wire buffer. Under Co = 1 only
+    // one byte follows the control byte and the next command would be read as a control byte.
+    ctx->wire->beginTransmission(ctx->i2c_addr);
+    ctx->wire->write(0x00);
+    ctx->wire->write(cmd, size);
+    return ctx->wire->endTransmission() == 0;
 }
 
 bool ssd1306_platform_write_data(const uint8_t *data, size_t size)
@@ -57,15 +63,15 @@ bool ssd1306_platform_write_data(const uint8_t *data, size_t size)
     const uint8_t control = 0x40;
     uint16_t sent = 0;
     while (sent < size) {
-        ctx.wire->beginTransmission(ctx.i2c_addr);
-        ctx.wire->write(control);
+        ctx->wire->beginTransmission(ctx->i2c_addr);
+        ctx->wire->write(control);
 
         // Send up to 16 bytes at a time for compatibility
         uint16_t chunk = (size - sent > 16) ? 16 : (size - sent);
-        ctx.wire->write(data + sent, chunk);
+        ctx->wire->write(data + sent, chunk);
         sent += chunk;
 
-        if (ctx.wire->endTransmission(sent < size) != 0) {
+        if (ctx->wire->endTransmission(sent < size) != 0) {
             return false;
         }
     }
@@ -81,6 +87,28 @@ bool ssd1306_platform_start_data_dma(const uint8_t *data, size_t size)
     return ssd1306_platform_write_data(data, size);
 }
 
+bool ssd1306_platform_start_stream_dma(const uint8_t *stream, uint16_t size)
+{
+    // A stream is longer than the Wire buffer, its commands and its data are sent the usual way instead.
+    // The boot stream carries 34 commands, they go out as one list so no command is cut off its arguments.
+    uint8_t cmds[48];
+    uint16_t count = 0;
+    uint16_t i = 0;
+    while (i + 1 < size && stream[i] == 0x80) {
+        cmds[count++] = stream[i + 1];
+        i += 2;
+        if (count == sizeof(cmds)) {
+            if (!ssd1306_platform_write_multi_command(cmds, count)) return false;
+            count = 0;
+        }
+    }
+    if (count && !ssd1306_platform_write_multi_command(cmds, count)) return false;
+    if (i < size && stream[i] == 0x40 && i + 1 < size) {
+        return ssd1306_platform_write_data(stream + i + 1, size - i - 1);
+    }
+    return true;
+}
+
 bool ssd1306_platform_is_dma_done()
 {
     // Always done since we use blocking transfer
@@ -109,12 +137,38 @@ bool ssd1306_platform_delay_us(uint32_t us)
 #include "esp_rom/ets_sys.h"  // for esp_rom_delay_us
 #include <string.h>           // for memcpy
 
-static ssd1306_platform_t ctx;
+static ssd1306_platform_t panels[SSD1306_MAX_PANELS];
+static bool panel_initialized[SSD1306_MAX_PANELS];
+static ssd1306_platform_t *ctx = &panels[0];
+
+void ssd1306_platform_init_panel(uint8_t panel, i2c_port_t i2c_port, uint8_t addr)
+{
+    if (panel >= SSD1306_MAX_PANELS) {
+        return;
+    }
+    panels[panel].i2c_port = i2c_port;
+    panels[panel].i2c_addr = addr;  // store 7-bit address
+    panel_initialized[panel] = true;
+}
 
 void ssd1306_platform_init(i2c_port_t i2c_port, uint8_t addr)
 {
-    ctx.i2c_port = i2c_port;
-    ctx.i2c_addr = addr;  // store 7-bit address
+    ssd1306_platform_init_panel(0, i2c_port, addr);
+    ctx = &panels[0];
+}
+
+bool ssd1306_platform_select(uint8_t panel)
+{
+    if (panel >= SSD1306_MAX_PANELS || !panel_initialized[panel]) {
+        return false;
+    }
+    ctx = &panels[panel];
+    return true;
+}
+
+uint8_t ssd1306_platform_selected(void)
+{
+    return static_cast<uint8_t>(ctx - panels);
 }
 
 static bool i2c_write(uint8_t control_byte, const uint8_t *data, size_t size)
@@ -124,13 +178,13 @@ static bool i2c_write(uint8_t control_byte, const uint8_t *data, size_t size)
 
     esp_err_t res = ESP_OK;
     res |= i2c_master_start(cmd);
-    res |= i2c_master_write_byte(cmd, (ctx.i2c_addr << 1) | I2C_MASTER_WRITE, true);
+    res |= i2c_master_write_byte(cmd, (ctx->i2c_addr << 1) | I2C_MASTER_WRITE, true);
     res |= i2c_master_write_byte(cmd, control_byte, true);
     if (size > 0) {
         res |= i2c_master_write(cmd, (uint8_t *)data, size, true);
     }
     res |= i2c_master_stop(cmd);
-    res |= i2c_master_cmd_begin(ctx.i2c_port, cmd, pdMS_TO_TICKS(100));
+    res |= i2c_master_cmd_begin(ctx->i2c_port, cmd, pdMS_TO_TICKS(100));
     i2c_cmd_link_delete(cmd);
 
     return res == ESP_OK;
@@ -144,13 +198,9 @@ bool ssd1306_platform_write_command(uint8_t cmd)
 bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size)
 {
     if (size == 0) return true;
-    if (size == 1) return ssd1306_platform_write_command(cmd[0]);
-
-    // Send first byte with control = 0x00
-    if (!i2c_write(0x00, &cmd[0], 1)) return false;
 
-    // Send remaining bytes with control = 0x80 (continuation)
-    return i2c_write(0x80, &cmd[1], size - 1);
+    // One transaction under Co = 0, D/C# = 0: every byte after the control byte is a command or an argument.
+    return i2c_write(0x00, cmd, size);
 }
 
 bool ssd1306_platform_write_data(const uint8_t *data, size_t size)
@@ -173,6 +223,13 @@ bool ssd1306_platform_start_data_dma(const uint8_t *data, size_t size)
     return ssd1306_platform_write_data(data, size);
 }
 
+bool ssd1306_platform_start_stream_dma(const uint8_t *stream, uint16_t size)
+{
+    if (size < 2) return false;
+    // One command link: the first control byte, then the rest of the stream as is.
+    return i2c_write(stream[0], stream + 1, size - 1);
+}
+
 bool ssd1306_platform_is_dma_done()
 {
     return true; // Always complete in blocking mode
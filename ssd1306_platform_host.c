@@ -0,0 +1,383 @@
+#ifdef SSD1306_USE_HOST
+
+#include "ssd1306_platform.h"
+#include <string.h>
+
+/*
+ * Simulated SSD1306 for host builds. Commands are parsed and applied to an emulated GDDRAM the way the controller
+ * addresses it, so addressing and flush bugs show up in what ssd1306_host_render() returns. Every platform call is
+ * counted and recorded as one transaction; tools/ and bench/ expand them into wire traffic per backend.
+ * Command arguments are expected within the call that sends the command, the parser restarts with every call.
+ * Transactions are framed by control bytes like on the wire and a call whose framing the controller would misread is
+ * rejected, so a backend change that sends a command list under Co = 1 fails the tests instead of garbling the panel.
+ * Each panel sits on a simulated bus, by default one of its own. A DMA transfer keeps its bus busy for every panel on
+ * it, so panels sharing a bus are flushed one after the other and panels on separate buses overlap.
+ */
+
+#define HOST_WIDTH  128
+#define HOST_HEIGHT 64
+#define HOST_PAGES  (HOST_HEIGHT / 8)
+
+/**
+ * @brief Controller state of one simulated panel.
+ */
+typedef struct {
+    ssd1306_platform_t ctx;
+    bool    initialized;
+    uint8_t bus;                /**< Panels with the same bus share one transfer at a time */
+    uint8_t gddram[HOST_PAGES * HOST_WIDTH];
+    uint8_t addressing_mode;
+    uint8_t col_start, col_end, page_start, page_end;
+    uint8_t col, page;
+    uint8_t start_line;
+    uint8_t display_offset;
+    bool    seg_remap, com_remap, inverted, entire_on, display_on;
+    uint8_t cmd_pending;
+    uint8_t cmd_args[6];
+    uint8_t cmd_args_needed, cmd_args_got;
+} host_panel_t;
+
+static host_panel_t panels[SSD1306_MAX_PANELS];
+static host_panel_t* sel = &panels[0];
+
+static ssd1306_host_stats_t stats;
+static ssd1306_host_transaction_t log_entries[SSD1306_HOST_LOG_SIZE];
+static uint32_t log_count;
+
+static uint32_t now_us;
+static uint32_t dma_bus_hz;
+static uint32_t dma_busy_until[SSD1306_MAX_PANELS];    // Indexed by bus.
+static bool dma_busy[SSD1306_MAX_PANELS];
+
+/**
+ * @brief  Number of argument bytes that follow a command byte.
+ */
+static uint8_t host_arg_count(uint8_t cmd){
+    switch (cmd) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x26: case 0x27:
+            return 4;   // Sent by ssd1306_StartScroll() as dummy, start page, end page, speed.
+        case 0x29: case 0x2A:
+            return 5;
+        default:
+            return 0;
+    }
+}
+
+static void host_execute(host_panel_t* p, uint8_t cmd, const uint8_t* args){
+    if (cmd <= 0x0F) {
+        p->col = (uint8_t)((p->col & 0xF0) | cmd);
+    } else if (cmd <= 0x1F) {
+        p->col = (uint8_t)((p->col & 0x0F) | ((cmd & 0x07) << 4));
+    } else if (cmd >= 0x40 && cmd <= 0x7F) {
+        p->start_line = cmd & 0x3F;
+    } else if (cmd >= 0xB0 && cmd <= 0xB7) {
+        p->page = cmd & 0x07;
+    } else {
+        switch (cmd) {
+            case 0x20: p->addressing_mode = args[0] & 0x03; break;
+            case 0x21:
+                p->col_start = args[0] & 0x7F; p->col_end = args[1] & 0x7F; p->col = p->col_start;
+                break;
+            case 0x22:
+                p->page_start = args[0] & 0x07; p->page_end = args[1] & 0x07; p->page = p->page_start;
+                break;
+            case 0xA0: p->seg_remap = false; break;
+            case 0xA1: p->seg_remap = true; break;
+            case 0xA4: p->entire_on = false; break;
+            case 0xA5: p->entire_on = true; break;
+            case 0xA6: p->inverted = false; break;
+            case 0xA7: p->inverted = true; break;
+            case 0xAE: p->display_on = false; break;
+            case 0xAF: p->display_on = true; break;
+            case 0xC0: p->com_remap = false; break;
+            case 0xC8: p->com_remap = true; break;
+            case 0xD3: p->display_offset = args[0] & 0x3F; break;
+            default: break; // Timing, power and scroll settings do not change the emulated picture.
+        }
+    }
+}
+
+static void host_command_byte(host_panel_t* p, uint8_t b){
+    if (p->cmd_args_needed) {
+        p->cmd_args[p->cmd_args_got++] = b;
+        if (p->cmd_args_got == p->cmd_args_needed) {
+            p->cmd_args_needed = 0;
+            host_execute(p, p->cmd_pending, p->cmd_args);
+        }
+        return;
+    }
+    p->cmd_pending = b;
+    p->cmd_args_got = 0;
+    p->cmd_args_needed = host_arg_count(b);
+    if (!p->cmd_args_needed) {
+        host_execute(p, b, p->cmd_args);
+    }
+}
+
+static void host_data_byte(host_panel_t* p, uint8_t b){
+    p->gddram[p->page * HOST_WIDTH + p->col] = b;
+    if (p->addressing_mode == 0x00) {
+        if (p->col++ >= p->col_end) {
+            p->col = p->col_start;
+            p->page = p->page >= p->page_end ? p->page_start : (uint8_t)(p->page + 1);
+        }
+    } else if (p->addressing_mode == 0x01) {
+        if (p->page++ >= p->page_end) {
+            p->page = p->page_start;
+            p->col = p->col >= p->col_end ? p->col_start : (uint8_t)(p->col + 1);
+        }
+    } else {
+        p->col = (uint8_t)((p->col + 1) & 0x7F);
+    }
+}
+
+/**
+ * @brief  Whether a transfer started on the bus of the selected panel is still on the wire.
+ */
+static bool host_bus_busy(void){
+    uint8_t bus = sel->bus;
+    if (dma_busy[bus] && (int32_t)(now_us - dma_busy_until[bus]) >= 0) {
+        dma_busy[bus] = false;
+    }
+    return dma_busy[bus];
+}
+
+/**
+ * @brief  Checks the control bytes of one transaction. A Co = 1 control byte is followed by one byte and the next
+ *         control byte, Co = 0 covers the rest of the transaction. The driver starts with 0x00, 0x40 or 0x80 and
+ *         follows a Co = 1 pair only with another pair or with 0x40 and the data; anything else in that position is
+ *         a byte of a command run that was sent under Co = 1.
+ * @param  control The control byte after the address.
+ * @param  payload The bytes after it.
+ * @param  size Number of bytes in the payload.
+ */
+static bool host_frame_valid(uint8_t control, const uint8_t* payload, uint16_t size){
+    if (control != 0x00 && control != 0x40 && control != 0x80) {
+        return false;
+    }
+    uint16_t i = 0;
+    while (control == 0x80) {
+        if (i + 1 >= size) {
+            return i < size;    // A Co = 1 control byte needs its byte, a last pair ends the transaction.
+        }
+        control = payload[i + 1];
+        i = (uint16_t)(i + 2);
+        if (control != 0x80 && control != 0x40) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void host_record(ssd1306_host_kind_t kind, uint16_t size){
+    stats.transactions++;
+    if (kind == SSD1306_HOST_DATA || kind == SSD1306_HOST_DATA_DMA) stats.data_bytes += size;
+    else stats.command_bytes += size;
+    if (log_count < SSD1306_HOST_LOG_SIZE) {
+        log_entries[log_count].kind = kind;
+        log_entries[log_count].size = size;
+        log_entries[log_count].panel = (uint8_t)(sel - panels);
+        log_count++;
+    } else {
+        stats.log_dropped++;
+    }
+    // A new call restarts the command parser.
+    sel->cmd_args_needed = 0;
+}
+
+void ssd1306_platform_init_panel(uint8_t panel, uint8_t addr){
+    if (panel >= SSD1306_MAX_PANELS) {
+        return;
+    }
+    host_panel_t* p = &panels[panel];
+    p->ctx.i2c_addr = addr;
+    p->initialized = true;
+    p->bus = panel;
+    // Reset state as per the datasheet.
+    memset(p->gddram, 0, sizeof(p->gddram));
+    p->addressing_mode = 0x02;
+    p->col_start = 0; p->col_end = HOST_WIDTH - 1;
+    p->page_start = 0; p->page_end = HOST_PAGES - 1;
+    p->col = 0; p->page = 0;
+    p->start_line = 0;
+    p->display_offset = 0;
+    p->seg_remap = p->com_remap = p->inverted = p->entire_on = p->display_on = false;
+    p->cmd_args_needed = 0;
+    dma_busy[p->bus] = false;
+}
+
+void ssd1306_platform_init(uint8_t addr){
+    ssd1306_platform_init_panel(0, addr);
+    sel = &panels[0];
+    ssd1306_host_reset_stats();
+}
+
+bool ssd1306_platform_select(uint8_t panel){
+    if (panel >= SSD1306_MAX_PANELS || !panels[panel].initialized) {
+        return false;
+    }
+    sel = &panels[panel];
+    return true;
+}
+
+uint8_t ssd1306_platform_selected(void){
+    return (uint8_t)(sel - panels);
+}
+
+bool ssd1306_platform_write_command(uint8_t cmd){
+    if (host_bus_busy()) {
+        return false;
+    }
+    host_record(SSD1306_HOST_COMMAND, 1);
+    host_command_byte(sel, cmd);
+    return true;
+}
+
+/**
+ * @brief  Records one transaction and applies its bytes, D/C# of each control byte selects command or data.
+ */
+static bool host_write_frame(ssd1306_host_kind_t kind, uint8_t control, const uint8_t* payload, uint16_t size){
+    if (host_bus_busy() || !host_frame_valid(control, payload, size)) {
+        return false;
+    }
+    host_record(kind, size);
+    uint16_t data = 0;
+    uint16_t i = 0;
+    while (i < size) {
+        uint16_t end = (control & 0x80) ? (uint16_t)(i + 1) : size;
+        for (; i < end; i++) {
+            if (control & 0x40) {
+                host_data_byte(sel, payload[i]);
+                data++;
+            } else {
+                host_command_byte(sel, payload[i]);
+            }
+        }
+        if (i < size) {
+            control = payload[i++];
+        }
+    }
+    stats.command_bytes -= data;
+    stats.data_bytes += data;
+    return true;
+}
+
+bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size){
+    // One transaction under Co = 0, D/C# = 0, as the hardware backends send it.
+    return host_write_frame(SSD1306_HOST_MULTI_COMMAND, 0x00, cmd, size);
+}
+
+bool ssd1306_platform_write_data(const uint8_t *data, uint16_t size){
+    if (host_bus_busy()) {
+        return false;
+    }
+    host_record(SSD1306_HOST_DATA, size);
+    for (uint16_t i = 0; i < size; i++) {
+        host_data_byte(sel, data[i]);
+    }
+    return true;
+}
+
+/**
+ * @brief  Keeps the bus of the selected panel busy for the wire time of a transaction with the given bytes after the address.
+ */
+static void host_start_dma(uint32_t bytes){
+    if (dma_bus_hz) {
+        // START, address, the bytes and STOP, 9 clocks per byte with the ACK.
+        uint64_t bits = 1 + 9 + 9ULL * bytes + 1;
+        dma_busy_until[sel->bus] = now_us + (uint32_t)(bits * 1000000ULL / dma_bus_hz);
+        dma_busy[sel->bus] = true;
+    }
+}
+
+bool ssd1306_platform_start_data_dma(const uint8_t *data, uint16_t size){
+    if (host_bus_busy()) {
+        return false;
+    }
+    host_record(SSD1306_HOST_DATA_DMA, size);
+    for (uint16_t i = 0; i < size; i++) {
+        host_data_byte(sel, data[i]);
+    }
+    host_start_dma(1u + size);
+    return true;
+}
+
+bool ssd1306_platform_start_stream_dma(const uint8_t *stream, uint16_t size){
+    if (size < 2 || !host_write_frame(SSD1306_HOST_STREAM, stream[0], &stream[1], (uint16_t)(size - 1))) {
+        return false;
+    }
+    host_start_dma(size);
+    return true;
+}
+
+bool ssd1306_platform_is_dma_done(){
+    return !host_bus_busy();
+}
+
+bool ssd1306_platform_delay_us(uint32_t us){
+    stats.delay_us += us;
+    return true;
+}
+
+const uint8_t* ssd1306_host_gddram(void){
+    return sel->gddram;
+}
+
+bool ssd1306_host_write_frame(uint8_t control, const uint8_t* payload, uint16_t size){
+    return host_write_frame(SSD1306_HOST_STREAM, control, payload, size);
+}
+
+uint8_t ssd1306_host_start_line(void){
+    return sel->start_line;
+}
+
+void ssd1306_host_render(uint8_t* pixels){
+    const host_panel_t* p = sel;
+    for (uint8_t y = 0; y < HOST_HEIGHT; y++) {
+        // The driver's init (0xA1, 0xC8) is the upright orientation.
+        uint8_t com = p->com_remap ? y : (uint8_t)(HOST_HEIGHT - 1 - y);
+        uint8_t row = (uint8_t)(com + p->start_line + p->display_offset) & (HOST_HEIGHT - 1);
+        for (uint8_t x = 0; x < HOST_WIDTH; x++) {
+            uint8_t column = p->seg_remap ? x : (uint8_t)(HOST_WIDTH - 1 - x);
+            bool lit = (p->gddram[(row >> 3) * HOST_WIDTH + column] >> (row & 7)) & 1;
+            if (p->entire_on) lit = true;
+            if (p->inverted) lit = !lit;
+            if (!p->display_on) lit = false;
+            pixels[y * HOST_WIDTH + x] = lit;
+        }
+    }
+}
+
+void ssd1306_host_get_stats(ssd1306_host_stats_t* out){
+    *out = stats;
+}
+
+void ssd1306_host_reset_stats(void){
+    memset(&stats, 0, sizeof(stats));
+    log_count = 0;
+}
+
+const ssd1306_host_transaction_t* ssd1306_host_log(uint32_t* count){
+    *count = log_count;
+    return log_entries;
+}
+
+void ssd1306_host_set_time_us(uint32_t time_us){
+    now_us = time_us;
+}
+
+void ssd1306_host_set_dma_bus_hz(uint32_t bus_hz){
+    dma_bus_hz = bus_hz;
+}
+
+void ssd1306_host_set_panel_bus(uint8_t panel, uint8_t bus){
+    if (panel < SSD1306_MAX_PANELS && bus < SSD1306_MAX_PANELS) {
+        panels[panel].bus = bus;
+    }
+}
+
+#endif // SSD1306_USE_HOST
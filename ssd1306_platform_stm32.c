@@ -17,67 +17,76 @@
     #error "Define SSD1306_ENABLE_TIMER_CLOCK() for your selected SSD1306_DELAY_TIMER"
 #endif
 
-static ssd1306_platform_t ctx;
-extern volatile bool ssd1306_dma_done; // Define and update this in your DMA complete callback
+static ssd1306_platform_t panels[SSD1306_MAX_PANELS];
+static ssd1306_platform_t* ctx = &panels[0];
 static TIM_HandleTypeDef htim_delay;
 static bool delay_timer_initialized = false;
 
 
+void ssd1306_platform_init_panel(uint8_t panel, I2C_HandleTypeDef *hi2c, DMA_HandleTypeDef *hdma_tx, uint8_t addr){
+    if (panel >= SSD1306_MAX_PANELS) {
+        return;
+    }
+    panels[panel].hi2c     = hi2c;
+    panels[panel].hdma_tx  = hdma_tx;
+    panels[panel].i2c_addr = (uint8_t)(addr << 1); // HAL expects 8-bit address (7-bit << 1)
+}
+
 void ssd1306_platform_init(I2C_HandleTypeDef *hi2c, DMA_HandleTypeDef *hdma_tx, uint8_t addr){
-    ctx.hi2c     = hi2c;
-    ctx.hdma_tx  = hdma_tx;
-    ctx.i2c_addr = (uint8_t)(addr << 1); // HAL expects 8-bit address (7-bit << 1)
+    ssd1306_platform_init_panel(0, hi2c, hdma_tx, addr);
+    ctx = &panels[0];
+}
+
+bool ssd1306_platform_select(uint8_t panel){
+    if (panel >= SSD1306_MAX_PANELS || panels[panel].hi2c == NULL) {
+        return false;
+    }
+    ctx = &panels[panel];
+    return true;
+}
+
+uint8_t ssd1306_platform_selected(void){
+    return (uint8_t)(ctx - panels);
 }
 
 bool ssd1306_platform_write_command(uint8_t cmd){
     uint8_t control = 0x00; // Co = 0, D/C# = 0
-    return HAL_I2C_Mem_Write(ctx.hi2c, ctx.i2c_addr, control, I2C_MEMADD_SIZE_8BIT, &cmd, 1, HAL_MAX_DELAY) == HAL_OK;
+    return HAL_I2C_Mem_Write(ctx->hi2c, ctx->i2c_addr, control, I2C_MEMADD_SIZE_8BIT, &cmd, 1, HAL_MAX_DELAY) == HAL_OK;
 }
 
 bool ssd1306_platform_write_multi_command(const uint8_t *cmd, uint16_t size){
     if (size == 0) return true;
 
-    // Send first command byte with 0x00
-    if (HAL_I2C_Mem_Write(ctx.hi2c, ctx.i2c_addr, 0x00, I2C_MEMADD_SIZE_8BIT, (uint8_t *)&cmd[0], 1, HAL_MAX_DELAY) != HAL_OK) {
-        return false;
-    }
-
-    if (size == 1){ 
-        return true;
-    }
-    
-    // Send remaining command bytes with 0x80 (continuation)
-    return HAL_I2C_Mem_Write(ctx.hi2c, ctx.i2c_addr, 0x80, I2C_MEMADD_SIZE_8BIT, (uint8_t *)&cmd[1], size - 1, HAL_MAX_DELAY) == HAL_OK;
+    // One transaction under Co = 0, D/C# = 0: every byte after the control byte is a command or an argument.
+    return HAL_I2C_Mem_Write(ctx->hi2c, ctx->i2c_addr, 0x00, I2C_MEMADD_SIZE_8BIT, (uint8_t *)cmd, size, HAL_MAX_DELAY) == HAL_OK;
 }
 
 bool ssd1306_platform_write_data(const uint8_t *data, size_t size){
     uint8_t control = 0x40; // Co = 0, D/C# = 1
-    return HAL_I2C_Mem_Write(ctx.hi2c, ctx.i2c_addr, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size, HAL_MAX_DELAY) == HAL_OK;
+    return HAL_I2C_Mem_Write(ctx->hi2c, ctx->i2c_addr, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size, HAL_MAX_DELAY) == HAL_OK;
 }
 
 bool ssd1306_platform_start_data_dma(const uint8_t *data, size_t size){
-    ssd1306_dma_done = false;
     uint8_t control = 0x40;
-    return HAL_I2C_Mem_Write_DMA(ctx.hi2c, ctx.i2c_addr, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size) == HAL_OK;
+    return HAL_I2C_Mem_Write_DMA(ctx->hi2c, ctx->i2c_addr, control, I2C_MEMADD_SIZE_8BIT, (uint8_t *)data, size) == HAL_OK;
+}
+
+bool ssd1306_platform_start_stream_dma(const uint8_t *stream, uint16_t size){
+    if (size < 2) return false;
+    // The first control byte goes out as the memory address, the rest of the stream is the payload.
+    return HAL_I2C_Mem_Write_DMA(ctx->hi2c, ctx->i2c_addr, stream[0], I2C_MEMADD_SIZE_8BIT, (uint8_t *)&stream[1], size - 1) == HAL_OK;
 }
 
 /**
- * @brief  Starts a DMA transfer of data to the SSD1306.
+ * @brief  Checks whether the DMA transfer on the bus of the selected panel has completed.
  *
  * NOTE:
- * - Before calling this, make sure DMA is properly initialized and linked to I2C TX.
- * - You must define and manage the `ssd1306_dma_done` flag.
- *
- * Example for your I2C DMA complete callback:
- *
- * void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {
- *     if (hi2c == ssd1306_ctx.hi2c) {
- *         ssd1306_dma_done = true;
- *     }
- * }
+ * - Before starting transfers, make sure DMA is properly initialized and linked to I2C TX.
+ * - The HAL returns the handle to READY from its transfer complete interrupt, so panels on separate
+ *   I2C peripherals are tracked independently and no completion flag has to be kept by the application.
  */
 bool ssd1306_platform_is_dma_done(){
-    return ssd1306_dma_done;
+    return HAL_I2C_GetState(ctx->hi2c) == HAL_I2C_STATE_READY;
 }
 
 bool ssd1306_platform_delay_us(uint32_t us){
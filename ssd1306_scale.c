@@ -0,0 +1,184 @@
+/*
+*   ssd1306_scale.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_scale.h"
+#include <stddef.h>
+#include <string.h>
+
+// Every bit of a nibble repeated 2, 3 and 4 times, LSB first like the page bytes.
+static const uint8_t spread2[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+static const uint16_t spread3[16] = {
+    0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF, 0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF
+};
+static const uint16_t spread4[16] = {
+    0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+    0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF
+};
+
+/**
+ * @brief A cached glyph, found by the address of its source columns.
+ */
+typedef struct {
+    const uint8_t* glyph;
+    uint16_t offset;    /**< Start of the spread columns in the cache buffer */
+    uint8_t  scale;
+    uint8_t  height;
+} ssd1306_scale_slot_t;
+
+static uint8_t* cache = NULL;
+static uint16_t cache_size = 0;
+static ssd1306_scale_slot_t slots[SSD1306_SCALE_CACHE_SLOTS];
+static ssd1306_scale_stats_t scale_stats;
+
+/**
+ * @brief  Spreads the 8 rows of a column byte to 8 * scale rows.
+ */
+static inline uint32_t ssd1306_Scale_Spread(uint8_t bits, uint8_t scale){
+    switch (scale) {
+    case 2:  return (uint32_t)spread2[bits & 0x0F] | ((uint32_t)spread2[bits >> 4] << 8);
+    case 3:  return (uint32_t)spread3[bits & 0x0F] | ((uint32_t)spread3[bits >> 4] << 12);
+    case 4:  return (uint32_t)spread4[bits & 0x0F] | ((uint32_t)spread4[bits >> 4] << 16);
+    default: return bits;
+    }
+}
+
+/**
+ * @brief  Writes one spread column, scale page bytes from y, into scale neighbouring columns.
+ */
+static void ssd1306_Scale_PutColumns(int16_t x, int16_t y, uint32_t spread, uint8_t scale, bool color){
+    for (uint8_t k = 0; k < scale; k++, y = (int16_t)(y + 8), spread >>= 8) {
+        uint8_t bits = (uint8_t)spread;
+        if (!bits)
+            continue;
+        for (uint8_t r = 0; r < scale; r++) {
+            ssd1306_WriteColumn((int16_t)(x + r), y, color ? bits : 0, bits);
+        }
+    }
+}
+
+bool ssd1306_Scale_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int w, int h, uint8_t scale, bool color){
+    if (!bitmap || scale == 0 || scale > SSD1306_SCALE_MAX)
+        return false;
+    int16_t max_x;
+    ssd1306_GetDrawSize(&max_x, NULL);
+    for (int16_t band = 0; band < h; band += 8) {
+        uint8_t rows = (uint8_t)(h - band < 8 ? h - band : 8);
+        uint8_t mask = (uint8_t)(0xFF >> (8 - rows));
+        const uint8_t* src = &bitmap[(band / 8) * w];
+        int16_t top = (int16_t)(y + band * scale);
+        for (int16_t i = 0; i < w; i++) {
+            int16_t left = (int16_t)(x + i * scale);
+            if (left >= max_x)
+                break;
+            uint8_t bits = (uint8_t)(src[i] & mask);
+            if (bits && left + scale > 0)
+                ssd1306_Scale_PutColumns(left, top, ssd1306_Scale_Spread(bits, scale), scale, color);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Finds a glyph in the cache or spreads it into the cache.
+ * @retval Pointer to width * scale spread bytes, column by column, or NULL when the glyph does not fit the budget.
+ */
+static const uint8_t* ssd1306_Scale_Cached(const uint8_t* glyph, FontDef font, uint8_t rows, uint8_t scale){
+    // Glyphs of a font are width bytes apart, neighbouring characters land in neighbouring slots.
+    uint16_t index = (uint16_t)(((uintptr_t)glyph / font.width + scale) % SSD1306_SCALE_CACHE_SLOTS);
+    ssd1306_scale_slot_t* slot = &slots[index];
+    if (slot->glyph == glyph && slot->scale == scale && slot->height == font.height) {
+        scale_stats.hits++;
+        return &cache[slot->offset];
+    }
+    uint16_t need = (uint16_t)(font.width * scale);
+    if (need > cache_size)
+        return NULL;
+    // Replaced slots leave their bytes behind, the budget is reclaimed all at once when it runs out.
+    if (scale_stats.used + need > cache_size) {
+        memset(slots, 0, sizeof(slots));
+        scale_stats.used = 0;
+        scale_stats.resets++;
+    }
+    uint8_t* dst = &cache[scale_stats.used];
+    for (uint8_t col = 0; col < font.width; col++) {
+        uint32_t spread = ssd1306_Scale_Spread((uint8_t)(glyph[col] & rows), scale);
+        for (uint8_t k = 0; k < scale; k++, spread >>= 8) {
+            *dst++ = (uint8_t)spread;
+        }
+    }
+    slot->glyph = glyph;
+    slot->offset = scale_stats.used;
+    slot->scale = scale;
+    slot->height = font.height;
+    scale_stats.used = (uint16_t)(scale_stats.used + need);
+    scale_stats.misses++;
+    return &cache[slot->offset];
+}
+
+bool ssd1306_Scale_WriteGlyph(int16_t x, int16_t y, uint32_t code, FontDef font, uint8_t scale, bool color){
+    if (scale == 0 || scale > SSD1306_SCALE_MAX)
+        return false;
+    const uint8_t* glyph = ssd1306_Font_Glyph(font, code);
+    if (!glyph)
+        return false;
+    uint8_t rows = font.height >= 8 ? 0xFF : (uint8_t)((1u << font.height) - 1);
+    const uint8_t* spread = cache ? ssd1306_Scale_Cached(glyph, font, rows, scale) : NULL;
+    for (uint8_t col = 0; col < font.width; col++, x = (int16_t)(x + scale)) {
+        if (spread) {
+            for (uint8_t k = 0; k < scale; k++) {
+                uint8_t bits = *spread++;
+                if (!bits)
+                    continue;
+                for (uint8_t r = 0; r < scale; r++) {
+                    ssd1306_WriteColumn((int16_t)(x + r), (int16_t)(y + 8 * k), color ? bits : 0, bits);
+                }
+            }
+        } else {
+            uint8_t bits = (uint8_t)(glyph[col] & rows);
+            if (bits)
+                ssd1306_Scale_PutColumns(x, y, ssd1306_Scale_Spread(bits, scale), scale, color);
+        }
+    }
+    return true;
+}
+
+bool ssd1306_Scale_WriteString(int16_t x, int16_t y, const char* str, uint16_t len, FontDef font, uint8_t scale, bool color){
+    if (scale == 0 || scale > SSD1306_SCALE_MAX)
+        return false;
+    int16_t max_x, max_y;
+    ssd1306_GetDrawSize(&max_x, &max_y);
+    const int16_t width = (int16_t)(font.width * scale);
+    const int16_t height = (int16_t)(font.height * scale);
+    for (uint16_t i = 0; i < len; ) {
+        uint32_t code = ssd1306_Utf8_Next(str, len, &i);
+        if (x + width > max_x) {
+            x = 0;
+            y = (int16_t)(y + height + scale);
+            if (y + height > max_y)
+                return false;
+        }
+        if (!ssd1306_Scale_WriteGlyph(x, y, code, font, scale, color))
+            return false;
+        x = (int16_t)(x + width + scale);
+    }
+    return true;
+}
+
+bool ssd1306_Scale_SetCache(uint8_t* buffer, uint16_t size){
+    if (buffer && size == 0)
+        return false;
+    cache = buffer;
+    cache_size = buffer ? size : 0;
+    memset(slots, 0, sizeof(slots));
+    memset(&scale_stats, 0, sizeof(scale_stats));
+    return true;
+}
+
+void ssd1306_Scale_GetStats(ssd1306_scale_stats_t* stats){
+    if (stats)
+        *stats = scale_stats;
+}
@@ -0,0 +1,95 @@
+/*
+*   ssd1306_scale.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_SCALE_H
+#define SSD1306_SCALE_H
+
+#include "ssd1306.h"
+
+/*
+ * Integer scaled glyphs and bitmaps. Every source column byte is spread vertically through a nibble lookup table,
+ * one bit becomes scale rows, and the resulting page bytes are written once per replicated column, so a 4x digit
+ * costs a few column writes instead of one rectangle per pixel. Scaled glyphs can be kept in a cache in a buffer
+ * given by the application, whose size is the RAM budget:
+ *
+ *   static uint8_t scale_cache[256];
+ *
+ *   ssd1306_Scale_SetCache(scale_cache, sizeof(scale_cache));
+ *   ssd1306_Scale_WriteString(0, 16, "12:45", 5, Font_5x8, 4, true);
+ */
+
+// Largest supported scale factor, a spread source byte fills at most 32 rows.
+#define SSD1306_SCALE_MAX 4
+
+// Glyphs the cache indexes at once, each slot costs 8 bytes of RAM on 32 bit targets besides the budget.
+#ifndef SSD1306_SCALE_CACHE_SLOTS
+#define SSD1306_SCALE_CACHE_SLOTS 16
+#endif
+
+/**
+ * @brief Glyph cache counters since ssd1306_Scale_SetCache().
+ */
+typedef struct {
+    uint32_t hits;      /**< Glyphs drawn from the cache */
+    uint32_t misses;    /**< Glyphs spread and added to the cache */
+    uint32_t resets;    /**< Times the budget ran out and the cache was emptied */
+    uint16_t used;      /**< Bytes of the budget in use */
+} ssd1306_scale_stats_t;
+
+/**
+ * @brief  Draws a bitmap enlarged by an integer factor. Only the set pixels of the bitmap are drawn.
+ * @param  x The horizontal component of the top left position of the scaled bitmap.
+ * @param  y The vertical component of the top left position of the scaled bitmap.
+ * @param  bitmap Column major, page aligned bitmap as used by ssd1306_DrawBitmap().
+ * @param  w Columns of the bitmap before scaling.
+ * @param  h Rows of the bitmap before scaling.
+ * @param  scale Factor from 1 to SSD1306_SCALE_MAX for both directions.
+ * @param  color Turn on or off the monochromatic oled along the bitmap.
+ * @retval true if the bitmap is drawn, false if the scale is not supported.
+ */
+bool ssd1306_Scale_DrawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int w, int h, uint8_t scale, bool color);
+
+/**
+ * @brief  Writes the glyph of a code point enlarged by an integer factor, through the cache when one is set.
+ * @param  x The horizontal component of the top left position of the character.
+ * @param  y The vertical component of the top left position of the character.
+ * @param  code Unicode code point.
+ * @param  font The font the character needs to be displayed in.
+ * @param  scale Factor from 1 to SSD1306_SCALE_MAX.
+ * @param  color Turn on or off the monochromatic oled along the character.
+ * @retval true if the character is drawn, false if the font has no glyph for it or the scale is not supported.
+ */
+bool ssd1306_Scale_WriteGlyph(int16_t x, int16_t y, uint32_t code, FontDef font, uint8_t scale, bool color);
+
+/**
+ * @brief  Writes a UTF-8 string enlarged by an integer factor, wrapping like ssd1306_WriteString(). Characters and
+ *         lines are scale pixels apart.
+ * @param  x The horizontal component of the top left position of the first character.
+ * @param  y The vertical component of the top left position of the first character.
+ * @param  str Pointer to the character array.
+ * @param  len The length of the character array in bytes.
+ * @param  font The font the string needs to be displayed in.
+ * @param  scale Factor from 1 to SSD1306_SCALE_MAX.
+ * @param  color Turn on or off the monochromatic oled along the string.
+ * @retval true if the whole string is drawn, false otherwise.
+ */
+bool ssd1306_Scale_WriteString(int16_t x, int16_t y, const char* str, uint16_t len, FontDef font, uint8_t scale, bool color);
+
+/**
+ * @brief  Sets the buffer scaled glyphs are kept in. A glyph takes font width * scale bytes and replaces the glyph
+ *         in its slot; when the budget runs out the whole cache is emptied and filled again.
+ * @param  buffer Pointer to the cache memory, NULL to spread every glyph as it is drawn.
+ * @param  size Size of the buffer in bytes, the RAM budget of the cache.
+ * @retval true if the cache has been set, false if a buffer is given without size.
+ */
+bool ssd1306_Scale_SetCache(uint8_t* buffer, uint16_t size);
+
+/**
+ * @brief  Reads the glyph cache counters.
+ * @param  stats Pointer to the counters to fill.
+ */
+void ssd1306_Scale_GetStats(ssd1306_scale_stats_t* stats);
+
+#endif // SSD1306_SCALE_H
@@ -0,0 +1,189 @@
+/*
+*   ssd1306_sprite.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_sprite.h"
+
+/**
+ * @brief  Mask of the valid rows of a page of a w x h image, the last page may be partly used.
+ */
+static inline uint8_t ssd1306_Sprite_RowMask(uint8_t h, uint8_t page){
+    uint8_t rows = (uint8_t)(h - page * 8);
+    return rows >= 8 ? 0xFF : (uint8_t)(0xFF >> (8 - rows));
+}
+
+/**
+ * @brief  Copies the frame buffer under the sprite box into, or back from, the save storage.
+ */
+static void ssd1306_Sprite_Background(ssd1306_sprite_t* sprite, bool restore){
+    const ssd1306_sprite_sheet_t* sheet = sprite->sheet;
+    uint8_t pages = (uint8_t)((sheet->h + 7) / 8);
+    for (uint8_t page = 0; page < pages; page++) {
+        uint8_t rows = ssd1306_Sprite_RowMask(sheet->h, page);
+        uint8_t* save = &sprite->save[page * sheet->w];
+        int16_t y = sprite->y + page * 8;
+        for (uint8_t col = 0; col < sheet->w; col++) {
+            if (restore)
+                ssd1306_WriteColumn(sprite->x + col, y, save[col], rows);
+            else
+                save[col] = ssd1306_ReadColumn(sprite->x + col, y);
+        }
+    }
+}
+
+bool ssd1306_Sprite_Init(ssd1306_sprite_t* sprite, const ssd1306_sprite_sheet_t* sheet, uint8_t* save, bool color){
+    if (!sheet || !save || sheet->frame_count == 0 || sheet->w == 0 || sheet->h == 0) {
+        return false;
+    }
+    sprite->sheet = sheet;
+    sprite->save = save;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->frame = 0;
+    sprite->visible = false;
+    sprite->color = color;
+    return true;
+}
+
+bool ssd1306_Sprite_Move(ssd1306_sprite_t* sprite, int16_t x, int16_t y, uint8_t frame){
+    const ssd1306_sprite_sheet_t* sheet = sprite->sheet;
+    if (frame >= sheet->frame_count) {
+        return false;
+    }
+    if (sprite->visible) {
+        ssd1306_Sprite_Background(sprite, true);
+    }
+    sprite->x = x;
+    sprite->y = y;
+    sprite->frame = frame;
+    ssd1306_Sprite_Background(sprite, false);
+
+    uint8_t pages = (uint8_t)((sheet->h + 7) / 8);
+    uint16_t frame_size = (uint16_t)(sheet->w * pages);
+    const uint8_t* bitmap = &sheet->frames[frame * frame_size];
+    const uint8_t* mask = sheet->masks ? &sheet->masks[frame * frame_size] : NULL;
+    uint8_t ink = sprite->color ? 0x00 : 0xFF;
+    for (uint8_t page = 0; page < pages; page++) {
+        uint8_t rows = ssd1306_Sprite_RowMask(sheet->h, page);
+        for (uint8_t col = 0; col < sheet->w; col++) {
+            uint16_t i = (uint16_t)(page * sheet->w + col);
+            uint8_t m = mask ? (uint8_t)(mask[i] & rows) : rows;
+            ssd1306_WriteColumn(x + col, y + page * 8, bitmap[i] ^ ink, m);
+        }
+    }
+    sprite->visible = true;
+    return true;
+}
+
+bool ssd1306_Sprite_Hide(ssd1306_sprite_t* sprite){
+    if (!sprite->visible) {
+        return false;
+    }
+    ssd1306_Sprite_Background(sprite, true);
+    sprite->visible = false;
+    return true;
+}
+
+bool ssd1306_Anim_Init(ssd1306_anim_t* anim, const uint8_t* stream, int16_t x, int16_t y){
+    if (!stream || stream[0] == 0 || stream[1] == 0 || stream[2] == 0) {
+        return false;
+    }
+    anim->stream = stream;
+    anim->w = stream[0];
+    anim->h = stream[1];
+    anim->frame_count = stream[2];
+    anim->x = x;
+    anim->y = y;
+    anim->frame = 0;
+
+    const uint8_t* key = stream + 3;
+    uint8_t pages = (uint8_t)((anim->h + 7) / 8);
+    for (uint8_t page = 0; page < pages; page++) {
+        uint8_t rows = ssd1306_Sprite_RowMask(anim->h, page);
+        for (uint8_t col = 0; col < anim->w; col++) {
+            ssd1306_WriteColumn(x + col, y + page * 8, key[page * anim->w + col], rows);
+        }
+    }
+    anim->next = key + anim->w * pages;
+    return true;
+}
+
+bool ssd1306_Anim_Step(ssd1306_anim_t* anim){
+    const uint8_t* p = anim->next;
+    uint16_t index = 0;
+    while (1) {
+        uint8_t skip = *p++;
+        uint8_t count = *p++;
+        if (skip == 0 && count == 0) {
+            break;
+        }
+        index = (uint16_t)(index + skip);
+        for (uint8_t i = 0; i < count; i++, index++) {
+            uint8_t page = (uint8_t)(index / anim->w);
+            uint8_t col = (uint8_t)(index % anim->w);
+            ssd1306_XorColumn(anim->x + col, anim->y + page * 8, *p++);
+        }
+    }
+
+    anim->frame++;
+    if (anim->frame == anim->frame_count) {
+        // The last delta returned to frame 0, start over from the first delta.
+        anim->frame = 0;
+        anim->next = anim->stream + 3 + anim->w * ((anim->h + 7) / 8);
+    } else {
+        anim->next = p;
+    }
+    return true;
+}
+
+uint32_t ssd1306_Anim_Encode(const uint8_t* frames, uint8_t w, uint8_t h, uint8_t frame_count, uint8_t* out, uint32_t capacity){
+    uint32_t frame_size = (uint32_t)w * ((h + 7) / 8);
+    uint32_t n = 0;
+    if (w == 0 || h == 0 || frame_count == 0 || capacity < 3 + frame_size) {
+        return 0;
+    }
+    out[n++] = w;
+    out[n++] = h;
+    out[n++] = frame_count;
+    for (uint32_t i = 0; i < frame_size; i++) {
+        out[n++] = frames[i];
+    }
+
+    for (uint8_t f = 0; f < frame_count; f++) {
+        const uint8_t* a = &frames[f * frame_size];
+        const uint8_t* b = &frames[((f + 1) % frame_count) * frame_size];
+        uint32_t i = 0;
+        uint32_t skip = 0;
+        while (i < frame_size) {
+            if (a[i] == b[i]) {
+                skip++;
+                i++;
+                continue;
+            }
+            while (skip > 254) {
+                if (n + 2 > capacity) return 0;
+                out[n++] = 255;
+                out[n++] = 0;
+                skip -= 255;
+            }
+            // Collect the changed run, up to 255 bytes.
+            uint32_t start = i;
+            while (i < frame_size && a[i] != b[i] && i - start < 255) {
+                i++;
+            }
+            uint32_t count = i - start;
+            if (n + 2 + count > capacity) return 0;
+            out[n++] = (uint8_t)skip;
+            out[n++] = (uint8_t)count;
+            for (uint32_t k = start; k < i; k++) {
+                out[n++] = a[k] ^ b[k];
+            }
+            skip = 0;
+        }
+        if (n + 2 > capacity) return 0;
+        out[n++] = 0;
+        out[n++] = 0;
+    }
+    return n;
+}
@@ -0,0 +1,112 @@
+/*
+*   ssd1306_sprite.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_SPRITE_H
+#define SSD1306_SPRITE_H
+
+#include "ssd1306.h"
+
+/**
+ * @brief Sprite sheet, frames are column major and page aligned like ssd1306_DrawBitmap() bitmaps, stored back to back.
+ */
+typedef struct {
+    const uint8_t* frames;      /**< Frame bitmaps, w * ((h + 7) / 8) bytes each */
+    const uint8_t* masks;       /**< Opacity masks in the same layout, a set bit draws the pixel. NULL for opaque frames */
+    uint8_t        w;           /**< Frame width in pixels */
+    uint8_t        h;           /**< Frame height in pixels */
+    uint8_t        frame_count; /**< Number of frames in the sheet */
+} ssd1306_sprite_sheet_t;
+
+/**
+ * @brief Sprite instance, keeps the background it covers so it can move without repainting the scene.
+ */
+typedef struct {
+    const ssd1306_sprite_sheet_t* sheet;
+    uint8_t* save;      /**< Background under the sprite, w * ((h + 7) / 8) bytes provided by the caller */
+    int16_t  x;         /**< Current position */
+    int16_t  y;
+    uint8_t  frame;     /**< Current frame */
+    bool     visible;   /**< true while the sprite is drawn and the background saved */
+    bool     color;     /**< Color of the set frame pixels, cleared opaque pixels get the opposite color */
+} ssd1306_sprite_t;
+
+/**
+ * @brief XOR delta animation, decoded by ssd1306_Anim_Step() straight onto the frame buffer.
+ *
+ * Stream layout, as produced by ssd1306_Anim_Encode():
+ *  - w, h, frame_count (1 byte each)
+ *  - frame 0, w * ((h + 7) / 8) bytes
+ *  - frame_count deltas, delta i turns frame i into frame (i + 1) % frame_count. Each delta is a list of
+ *    (skip, count, count XOR bytes) runs over the frame bytes, ended by a (0, 0) run. A (255, 0) run only skips.
+ */
+typedef struct {
+    const uint8_t* stream;  /**< Start of the stream */
+    const uint8_t* next;    /**< Next delta to apply */
+    int16_t        x;       /**< Position of the animation */
+    int16_t        y;
+    uint8_t        w;
+    uint8_t        h;
+    uint8_t        frame_count;
+    uint8_t        frame;   /**< Frame currently in the frame buffer */
+} ssd1306_anim_t;
+
+/**
+ * @brief  Binds a sprite to its sheet and its background storage. The sprite starts hidden.
+ * @param  sprite Pointer to the sprite.
+ * @param  sheet Pointer to the sprite sheet.
+ * @param  save Pointer to w * ((h + 7) / 8) bytes for the background under the sprite.
+ * @param  color Color of the set frame pixels.
+ * @retval true if the sprite has been set up, false otherwise.
+ */
+bool ssd1306_Sprite_Init(ssd1306_sprite_t* sprite, const ssd1306_sprite_sheet_t* sheet, uint8_t* save, bool color);
+
+/**
+ * @brief  Moves the sprite and selects its frame. The background at the old position is restored and the one at the new position saved,
+ *         so only the two sprite boxes are modified.
+ * @param  sprite Pointer to the sprite.
+ * @param  x New horizontal position of the top left corner.
+ * @param  y New vertical position of the top left corner.
+ * @param  frame Frame of the sheet to show.
+ * @retval true if the sprite has been drawn, false otherwise.
+ */
+bool ssd1306_Sprite_Move(ssd1306_sprite_t* sprite, int16_t x, int16_t y, uint8_t frame);
+
+/**
+ * @brief  Removes the sprite by restoring the background under it.
+ * @param  sprite Pointer to the sprite.
+ * @retval true if the sprite has been removed, false if it was not visible.
+ */
+bool ssd1306_Sprite_Hide(ssd1306_sprite_t* sprite);
+
+/**
+ * @brief  Starts an animation by drawing its first frame.
+ * @param  anim Pointer to the animation.
+ * @param  stream Pointer to the encoded animation.
+ * @param  x Horizontal position of the top left corner.
+ * @param  y Vertical position of the top left corner.
+ * @retval true if the first frame has been drawn, false otherwise.
+ */
+bool ssd1306_Anim_Init(ssd1306_anim_t* anim, const uint8_t* stream, int16_t x, int16_t y);
+
+/**
+ * @brief  Advances the animation by one frame, XORing only the changed bytes onto the frame buffer.
+ * @param  anim Pointer to the animation.
+ * @retval true if the next frame has been applied, false otherwise.
+ */
+bool ssd1306_Anim_Step(ssd1306_anim_t* anim);
+
+/**
+ * @brief  Encodes frames into an XOR delta animation stream, for offline or host side use.
+ * @param  frames Pointer to frame_count bitmaps of w * ((h + 7) / 8) bytes each.
+ * @param  w Frame width in pixels.
+ * @param  h Frame height in pixels.
+ * @param  frame_count Number of frames.
+ * @param  out Pointer to the output stream.
+ * @param  capacity Size of the output in bytes.
+ * @retval Number of bytes written, 0 if the output is too small.
+ */
+uint32_t ssd1306_Anim_Encode(const uint8_t* frames, uint8_t w, uint8_t h, uint8_t frame_count, uint8_t* out, uint32_t capacity);
+
+#endif // SSD1306_SPRITE_H
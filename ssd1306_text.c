@@ -0,0 +1,258 @@
+/*
+*   ssd1306_text.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#include "ssd1306_text.h"
+#include "ssd1306_scale.h"
+#include <string.h>
+
+#define SSD1306_ELLIPSIS_DOTS 3
+
+uint16_t ssd1306_Text_Measure(uint16_t len, FontDef font){
+    return len ? (uint16_t)(len * (font.width + 1u) - 1u) : 0;
+}
+
+/**
+ * @brief  Counts the UTF-8 characters between pos and end.
+ */
+static uint16_t ssd1306_Text_Count(const char* str, uint16_t pos, uint16_t end){
+    uint16_t count = 0;
+    while (pos < end) {
+        ssd1306_Utf8_Next(str, end, &pos);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief  Moves pos forward by count UTF-8 characters, stopping at end.
+ */
+static uint16_t ssd1306_Text_Advance(const char* str, uint16_t pos, uint16_t end, uint16_t count){
+    while (count-- > 0 && pos < end) {
+        ssd1306_Utf8_Next(str, end, &pos);
+    }
+    return pos;
+}
+
+uint16_t ssd1306_Text_MeasureString(const char* str, uint16_t len, FontDef font){
+    return str ? ssd1306_Text_Measure(ssd1306_Text_Count(str, 0, len), font) : 0;
+}
+
+/**
+ * @brief  Checks whether only spaces and line breaks are left from pos.
+ */
+static bool ssd1306_Text_Blank(const char* str, uint16_t pos, uint16_t len){
+    for (; pos < len; pos++) {
+        if (str[pos] != ' ' && str[pos] != '\n') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Adds a line and places it in the box, with dots when text after it is cut off.
+ */
+static void ssd1306_Text_AddLine(ssd1306_text_layout_t* layout, uint16_t start, uint16_t len, uint16_t columns,
+                                 bool cut, bool dots, ssd1306_align_t align){
+    const char* str = layout->str;
+    ssd1306_text_line_t* line = &layout->lines[layout->line_count++];
+    uint8_t ellipsis = 0;
+    if (cut && dots) {
+        ellipsis = columns < SSD1306_ELLIPSIS_DOTS ? (uint8_t)columns : SSD1306_ELLIPSIS_DOTS;
+        uint16_t end = (uint16_t)(start + len);
+        if (ssd1306_Text_Count(str, start, end) + ellipsis > columns) {
+            len = (uint16_t)(ssd1306_Text_Advance(str, start, end, (uint16_t)(columns - ellipsis)) - start);
+        }
+    }
+    // Trailing spaces would shift centered and right aligned lines.
+    while (len > 0 && str[start + len - 1] == ' ') {
+        len--;
+    }
+    line->start = start;
+    line->len = len;
+    line->ellipsis = ellipsis;
+    uint16_t glyphs = ssd1306_Text_Count(str, start, (uint16_t)(start + len));
+    line->width = ssd1306_Text_Measure((uint16_t)(glyphs + ellipsis), layout->font);
+    if (align == SSD1306_ALIGN_CENTER) {
+        line->x = (int16_t)((layout->w - line->width) / 2);
+    } else if (align == SSD1306_ALIGN_RIGHT) {
+        line->x = (int16_t)(layout->w - line->width);
+    } else {
+        line->x = 0;
+    }
+    if (line->width > layout->width) {
+        layout->width = line->width;
+    }
+}
+
+bool ssd1306_Text_Layout(ssd1306_text_layout_t* layout, const char* str, uint16_t len, FontDef font,
+                         int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_align_t align, uint8_t flags){
+    if (!layout || (!str && len)) {
+        return false;
+    }
+    memset(layout, 0, sizeof(*layout));
+    layout->str = str;
+    layout->font = font;
+    layout->x = x;
+    layout->y = y;
+    layout->w = w;
+    layout->h = h;
+
+    // Whole glyphs per line and whole lines in the box, the spacing after the last one may fall outside.
+    int16_t columns = w < font.width ? 0 : (int16_t)((w + 1) / (font.width + 1));
+    int16_t rows = h < font.height ? 0 : (int16_t)((h + 1) / (font.height + 1));
+    if (rows > SSD1306_TEXT_MAX_LINES) {
+        rows = SSD1306_TEXT_MAX_LINES;
+    }
+    if (columns == 0 || rows == 0) {
+        layout->truncated = len > 0;
+        return len == 0;
+    }
+
+    bool dots = (flags & SSD1306_TEXT_ELLIPSIS) != 0;
+    uint16_t pos = 0;
+    while (pos < len) {
+        uint16_t end = pos;
+        while (end < len && str[end] != '\n') {
+            end++;
+        }
+        uint16_t take = (uint16_t)(end - pos);
+        uint16_t next = end < len ? (uint16_t)(end + 1) : end;
+        bool clipped = false;
+        // Columns hold characters, a multi-byte sequence takes one column like an ASCII byte.
+        uint16_t limit = ssd1306_Text_Advance(str, pos, end, (uint16_t)columns);
+        if (limit < end) {
+            if (!(flags & SSD1306_TEXT_WRAP)) {
+                // A single line is cut at the box edge, the rest of it up to the line break is dropped.
+                take = (uint16_t)(limit - pos);
+                clipped = true;
+            } else {
+                // Break at the last space that leaves the line within the box, or inside a word longer than a line.
+                // Spaces are single bytes and never part of a multi-byte sequence.
+                uint16_t brk = limit;
+                while (brk > pos && str[brk] != ' ') {
+                    brk--;
+                }
+                if (brk == pos) {
+                    take = (uint16_t)(limit - pos);
+                    next = limit;
+                } else {
+                    take = (uint16_t)(brk - pos);
+                    next = brk;
+                    while (next < end && str[next] == ' ') {
+                        next++;
+                    }
+                    if (next == end && end < len) {
+                        next++;
+                    }
+                }
+            }
+        }
+        bool last = layout->line_count + 1 == rows;
+        bool more = last && !ssd1306_Text_Blank(str, next, len);
+        if (clipped || more) {
+            layout->truncated = true;
+        }
+        ssd1306_Text_AddLine(layout, pos, take, (uint16_t)columns, clipped || more, dots, align);
+        if (last) {
+            break;
+        }
+        pos = next;
+    }
+    if (layout->line_count) {
+        layout->height = (uint16_t)(layout->line_count * (font.height + 1) - 1);
+    }
+    return !layout->truncated;
+}
+
+bool ssd1306_Text_Draw(const ssd1306_text_layout_t* layout, bool color){
+    const FontDef font = layout->font;
+    bool ok = true;
+    for (uint8_t i = 0; i < layout->line_count; i++) {
+        const ssd1306_text_line_t* line = &layout->lines[i];
+        int16_t x = (int16_t)(layout->x + line->x);
+        int16_t y = (int16_t)(layout->y + i * (font.height + 1));
+        uint16_t end = (uint16_t)(line->start + line->len);
+        for (uint16_t pos = line->start; pos < end; ) {
+            ok &= ssd1306_WriteGlyph(x, y, ssd1306_Utf8_Next(layout->str, end, &pos), font, color);
+            x = (int16_t)(x + font.width + 1);
+        }
+        for (uint8_t d = 0; d < line->ellipsis; d++) {
+            ssd1306_WriteChar(x, y, '.', font, color);
+            x = (int16_t)(x + font.width + 1);
+        }
+    }
+    return ok;
+}
+
+bool ssd1306_Text_FieldInit(ssd1306_text_field_t* field, int16_t x, int16_t y, uint8_t columns, FontDef font,
+                            uint8_t scale, ssd1306_align_t align, bool color){
+    if (!field || columns == 0 || columns > SSD1306_TEXT_FIELD_MAX_CELLS || scale == 0 || scale > SSD1306_SCALE_MAX)
+        return false;
+    memset(field, 0, sizeof(*field));
+    field->font = font;
+    field->x = x;
+    field->y = y;
+    field->columns = columns;
+    field->scale = scale;
+    field->align = align;
+    field->color = color;
+    return true;
+}
+
+bool ssd1306_Text_FieldSet(ssd1306_text_field_t* field, const char* str, uint16_t len){
+    if (!field || field->columns == 0 || (!str && len))
+        return false;
+    const FontDef font = field->font;
+    const uint8_t scale = field->scale;
+    const int16_t pitch = (int16_t)((font.width + 1) * scale);
+
+    // Decode into the new cell contents first, spaces are blank cells so padding never causes a redraw.
+    uint32_t cells[SSD1306_TEXT_FIELD_MAX_CELLS];
+    uint16_t count = ssd1306_Text_Count(str, 0, len);
+    bool ok = count <= field->columns;
+    if (!ok)
+        count = field->columns;
+    uint8_t first = 0;
+    if (field->align == SSD1306_ALIGN_RIGHT)
+        first = (uint8_t)(field->columns - count);
+    else if (field->align == SSD1306_ALIGN_CENTER)
+        first = (uint8_t)((field->columns - count) / 2);
+    memset(cells, 0, sizeof(cells));
+    uint16_t pos = 0;
+    for (uint8_t c = first; c < first + count; c++) {
+        uint32_t code = ssd1306_Utf8_Next(str, len, &pos);
+        cells[c] = code == ' ' ? 0 : code;
+    }
+
+    if (!field->valid) {
+        ssd1306_FillRect(field->x, field->y, (int16_t)(field->columns * pitch - scale), (int16_t)(font.height * scale),
+                         !field->color);
+    }
+    field->redrawn = 0;
+    for (uint8_t c = 0; c < field->columns; c++) {
+        if (field->valid && cells[c] == field->cells[c])
+            continue;
+        int16_t cx = (int16_t)(field->x + c * pitch);
+        // The spacing column after a cell is never drawn into, only the glyph columns are cleared.
+        if (field->valid)
+            ssd1306_FillRect(cx, field->y, (int16_t)(font.width * scale), (int16_t)(font.height * scale), !field->color);
+        if (cells[c]) {
+            if (scale == 1)
+                ok &= ssd1306_WriteGlyph(cx, field->y, cells[c], font, field->color);
+            else
+                ok &= ssd1306_Scale_WriteGlyph(cx, field->y, cells[c], font, scale, field->color);
+        }
+        field->cells[c] = cells[c];
+        field->redrawn++;
+    }
+    field->valid = true;
+    return ok;
+}
+
+void ssd1306_Text_FieldInvalidate(ssd1306_text_field_t* field){
+    if (field)
+        field->valid = false;
+}
@@ -0,0 +1,175 @@
+/*
+*   ssd1306_text.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_TEXT_H
+#define SSD1306_TEXT_H
+
+#include "ssd1306.h"
+
+/*
+ * Text layout without drawing. A string is measured and broken into lines inside a box once, the result is kept in
+ * a ssd1306_text_layout_t and drawn as often as needed with ssd1306_Text_Draw(), which only writes glyph columns.
+ * Static labels are laid out at start up; nothing is drawn to find out whether text fits. Strings are UTF-8, every
+ * character takes one glyph cell whatever the length of its sequence.
+ *
+ *   static ssd1306_text_layout_t label;
+ *
+ *   ssd1306_Text_Layout(&label, "Outside temperature", 19, Font_5x8, 0, 0, 60, 18,
+ *                       SSD1306_ALIGN_CENTER, SSD1306_TEXT_WRAP | SSD1306_TEXT_ELLIPSIS);
+ *   ssd1306_Text_Draw(&label, true);
+ *
+ * Values that change at run time go into a text field, a row of fixed character cells that remembers what it shows.
+ * Setting new text redraws only the cells whose character changed, so ssd1306_UpdateDirty() sends just those:
+ *
+ *   static ssd1306_text_field_t rpm;
+ *
+ *   ssd1306_Text_FieldInit(&rpm, 0, 0, 9, Font_5x8, 1, SSD1306_ALIGN_LEFT, true);
+ *   len = snprintf(text, sizeof(text), "RPM: %u", value);
+ *   ssd1306_Text_FieldSet(&rpm, text, len);
+ *   ssd1306_UpdateDirty();
+ */
+
+// Lines a layout keeps, text past them is truncated.
+#ifndef SSD1306_TEXT_MAX_LINES
+#define SSD1306_TEXT_MAX_LINES 8
+#endif
+
+// Character cells a text field holds at most, a full 5x8 line.
+#ifndef SSD1306_TEXT_FIELD_MAX_CELLS
+#define SSD1306_TEXT_FIELD_MAX_CELLS 21
+#endif
+
+// Layout flags.
+#define SSD1306_TEXT_WRAP       0x01    /**< Break lines at spaces, or inside words longer than a line */
+#define SSD1306_TEXT_ELLIPSIS   0x02    /**< End the last line with "..." when text is cut off */
+
+/**
+ * @brief Horizontal alignment of the lines in the layout box.
+ */
+typedef enum {
+    SSD1306_ALIGN_LEFT = 0,
+    SSD1306_ALIGN_CENTER,
+    SSD1306_ALIGN_RIGHT
+} ssd1306_align_t;
+
+/**
+ * @brief One laid out line, a run of the string plus an optional ellipsis.
+ */
+typedef struct {
+    uint16_t start;     /**< Byte offset of the first character in the string */
+    uint16_t len;       /**< Bytes of the string on the line */
+    int16_t  x;         /**< Offset of the line from the left of the box */
+    uint16_t width;     /**< Width in pixels including the ellipsis */
+    uint8_t  ellipsis;  /**< Dots following the characters, 3 unless the box is narrower */
+} ssd1306_text_line_t;
+
+/**
+ * @brief Result of ssd1306_Text_Layout(). It points at the string, which must stay valid while the layout is drawn.
+ */
+typedef struct {
+    const char* str;
+    FontDef     font;
+    int16_t     x;          /**< Left of the box */
+    int16_t     y;          /**< Top of the box */
+    int16_t     w;          /**< Width of the box */
+    int16_t     h;          /**< Height of the box */
+    uint16_t    width;      /**< Width of the widest line */
+    uint16_t    height;     /**< Height of the lines, without spacing below the last */
+    uint8_t     line_count;
+    bool        truncated;  /**< Part of the string did not fit */
+    ssd1306_text_line_t lines[SSD1306_TEXT_MAX_LINES];
+} ssd1306_text_layout_t;
+
+/**
+ * @brief A fixed row of character cells and the characters it currently shows.
+ */
+typedef struct {
+    FontDef  font;
+    int16_t  x;             /**< Left of the first cell */
+    int16_t  y;             /**< Top of the cells */
+    uint8_t  columns;       /**< Number of cells */
+    uint8_t  scale;         /**< Integer scale of the glyphs, 1 for the plain font */
+    ssd1306_align_t align;  /**< Placement of shorter text within the cells */
+    bool     color;         /**< Color of the text, the cells are cleared to the other color */
+    bool     valid;         /**< The cells show what cells[] holds */
+    uint8_t  redrawn;       /**< Cells redrawn by the last ssd1306_Text_FieldSet() */
+    uint32_t cells[SSD1306_TEXT_FIELD_MAX_CELLS]; /**< Code point per cell, 0 for a blank cell */
+} ssd1306_text_field_t;
+
+/**
+ * @brief  Width of a single line of text, glyphs are separated by one column.
+ * @param  len The number of characters.
+ * @param  font The font of the text.
+ * @retval Width in pixels, 0 for no characters.
+ */
+uint16_t ssd1306_Text_Measure(uint16_t len, FontDef font);
+
+/**
+ * @brief  Width of a single line of UTF-8 text.
+ * @param  str Pointer to the character array.
+ * @param  len The length of the character array in bytes.
+ * @param  font The font of the text.
+ * @retval Width in pixels, 0 for no characters.
+ */
+uint16_t ssd1306_Text_MeasureString(const char* str, uint16_t len, FontDef font);
+
+/**
+ * @brief  Breaks a string into lines inside a box, without drawing. '\n' always starts a new line, spaces at a
+ *         wrapped line break are dropped. Lines are 1 pixel apart like ssd1306_WriteString().
+ * @param  layout Pointer to the layout to fill.
+ * @param  str Pointer to the UTF-8 character array.
+ * @param  len The length of the character array in bytes.
+ * @param  font The font of the text.
+ * @param  x Left of the box.
+ * @param  y Top of the box.
+ * @param  w Width of the box.
+ * @param  h Height of the box.
+ * @param  align Horizontal alignment of every line.
+ * @param  flags SSD1306_TEXT_WRAP and SSD1306_TEXT_ELLIPSIS, 0 to clip single lines at the box edge.
+ * @retval true if the whole string fits the box, false if it was truncated or the box holds no line.
+ */
+bool ssd1306_Text_Layout(ssd1306_text_layout_t* layout, const char* str, uint16_t len, FontDef font,
+                         int16_t x, int16_t y, int16_t w, int16_t h, ssd1306_align_t align, uint8_t flags);
+
+/**
+ * @brief  Draws a layout at its box with one masked column write per glyph column.
+ * @param  layout Pointer to the layout.
+ * @param  color Turn on or off the monochromatic oled along the text.
+ * @retval true if every character is covered by the font, false otherwise.
+ */
+bool ssd1306_Text_Draw(const ssd1306_text_layout_t* layout, bool color);
+
+/**
+ * @brief  Sets up a text field. Nothing is drawn until the first ssd1306_Text_FieldSet(), which draws every cell.
+ * @param  field Pointer to the field.
+ * @param  x Left of the first cell.
+ * @param  y Top of the cells.
+ * @param  columns Number of cells, 1 to SSD1306_TEXT_FIELD_MAX_CELLS.
+ * @param  font The font of the text.
+ * @param  scale Integer scale from 1 to SSD1306_SCALE_MAX.
+ * @param  align Placement of text shorter than the field.
+ * @param  color Turn on or off the monochromatic oled along the text.
+ * @retval true if the field has been set up, false otherwise.
+ */
+bool ssd1306_Text_FieldInit(ssd1306_text_field_t* field, int16_t x, int16_t y, uint8_t columns, FontDef font,
+                            uint8_t scale, ssd1306_align_t align, bool color);
+
+/**
+ * @brief  Shows new text in a field. Only cells whose character changed are cleared and drawn again, cells left
+ *         over by longer text are cleared, and the drawing marks just those cells for ssd1306_UpdateDirty().
+ * @param  field Pointer to the field.
+ * @param  str Pointer to the UTF-8 character array.
+ * @param  len The length of the character array in bytes.
+ * @retval true if the text fits the field and the font covers it, false if characters were dropped.
+ */
+bool ssd1306_Text_FieldSet(ssd1306_text_field_t* field, const char* str, uint16_t len);
+
+/**
+ * @brief  Makes the next ssd1306_Text_FieldSet() clear and draw the whole field, e.g. after the screen was cleared.
+ * @param  field Pointer to the field.
+ */
+void ssd1306_Text_FieldInvalidate(ssd1306_text_field_t* field);
+
+#endif // SSD1306_TEXT_H
@@ -0,0 +1,306 @@
+/*
+*   ssd1306_video.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifdef __linux__
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include "ssd1306_video.h"
+#include <string.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief  Provides a pointer to len bytes of the stream at offset, refilling the chunk for callback sources.
+ * @retval Pointer to the bytes, NULL if they are past the end of the stream.
+ */
+static const uint8_t* ssd1306_Video_Peek(ssd1306_video_t* video, uint32_t offset, uint16_t len){
+    if (video->data) {
+        if (offset + len > video->size) return NULL;
+        return video->data + offset;
+    }
+    if (len > SSD1306_VIDEO_READ_CHUNK) return NULL;
+    if (offset < video->chunk_offset || offset + len > video->chunk_offset + video->chunk_len) {
+        video->chunk_offset = offset;
+        video->chunk_len = video->read(video->read_ctx, offset, video->chunk, SSD1306_VIDEO_READ_CHUNK);
+        if (video->chunk_len < len) return NULL;
+    }
+    return &video->chunk[offset - video->chunk_offset];
+}
+
+/**
+ * @brief  Checks the header and rewinds to the first frame.
+ */
+static bool ssd1306_Video_Open(ssd1306_video_t* video, bool loop){
+    video->chunk_offset = 0;
+    video->chunk_len = 0;
+    const uint8_t* h = ssd1306_Video_Peek(video, 0, SSD1306_VIDEO_HEADER_SIZE);
+    if (!h || memcmp(h, "S1VD", 4) != 0 || h[4] != SSD1306_VIDEO_VERSION || h[5] != 128 || h[6] != 64 || h[7] == 0) {
+        return false;
+    }
+    video->fps = h[7];
+    video->frame_count = (uint32_t)h[8] | ((uint32_t)h[9] << 8) | ((uint32_t)h[10] << 16) | ((uint32_t)h[11] << 24);
+    video->first_frame = SSD1306_VIDEO_HEADER_SIZE;
+    video->offset = video->first_frame;
+    video->next_frame = 0;
+    video->loop = loop;
+    video->started = false;
+    video->pending = false;
+    memset(&video->stats, 0, sizeof(video->stats));
+    // Frames are written at GDDRAM row 0 onwards, page for page.
+    return video->frame_count > 0 && ssd1306_ResetScroll();
+}
+
+bool ssd1306_Video_OpenMemory(ssd1306_video_t* video, const uint8_t* data, uint32_t size, bool loop){
+    if (!data) return false;
+    video->data = data;
+    video->size = size;
+    video->read = NULL;
+    video->mapped = false;
+    return ssd1306_Video_Open(video, loop);
+}
+
+bool ssd1306_Video_OpenReader(ssd1306_video_t* video, ssd1306_video_read_t read, void* ctx, bool loop){
+    if (!read) return false;
+    video->data = NULL;
+    video->size = 0;
+    video->read = read;
+    video->read_ctx = ctx;
+    video->mapped = false;
+    return ssd1306_Video_Open(video, loop);
+}
+
+#ifdef __linux__
+bool ssd1306_Video_OpenFile(ssd1306_video_t* video, const char* path, bool loop){
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < SSD1306_VIDEO_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    // Frames are read front to back once per loop.
+    posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+
+    if (!ssd1306_Video_OpenMemory(video, (const uint8_t*)map, (uint32_t)st.st_size, loop)) {
+        munmap(map, (size_t)st.st_size);
+        return false;
+    }
+    video->mapped = true;
+    return true;
+}
+#endif
+
+void ssd1306_Video_Close(ssd1306_video_t* video){
+#ifdef __linux__
+    if (video->mapped) {
+        munmap((void*)video->data, video->size);
+    }
+#endif
+    video->data = NULL;
+    video->read = NULL;
+    video->mapped = false;
+}
+
+/**
+ * @brief  Reads the type and payload length of the frame at offset.
+ */
+static bool ssd1306_Video_FrameHeader(ssd1306_video_t* video, uint32_t offset, uint8_t* type, uint16_t* len){
+    const uint8_t* h = ssd1306_Video_Peek(video, offset, 3);
+    if (!h) return false;
+    *type = h[0];
+    *len = (uint16_t)(h[1] | (h[2] << 8));
+    return *type == SSD1306_VIDEO_KEYFRAME || *type == SSD1306_VIDEO_DELTA;
+}
+
+/**
+ * @brief  Duration of one pass through the stream.
+ */
+static inline uint32_t ssd1306_Video_LoopUs(const ssd1306_video_t* video){
+    return (uint32_t)((uint64_t)video->frame_count * 1000000UL / video->fps);
+}
+
+/**
+ * @brief  Steps past the frame at the current offset, wrapping to the first frame for looping streams. The clock
+ *         moves on by one pass, so frame 0 of the next pass is due 1/fps after the last frame like any other.
+ */
+static void ssd1306_Video_Advance(ssd1306_video_t* video, uint16_t len){
+    video->offset += 3u + len;
+    video->next_frame++;
+    if (video->next_frame == video->frame_count && video->loop) {
+        video->next_frame = 0;
+        video->offset = video->first_frame;
+        video->start_us += ssd1306_Video_LoopUs(video);
+    }
+}
+
+bool ssd1306_Video_DecodeNext(ssd1306_video_t* video){
+    uint8_t type;
+    uint16_t len;
+    if (ssd1306_Video_Ended(video) || !ssd1306_Video_FrameHeader(video, video->offset, &type, &len)) {
+        return false;
+    }
+
+    uint32_t pos = video->offset + 3;
+    uint32_t end = pos + len;
+    uint16_t index = 0;
+    uint32_t written = 0;
+    while (pos < end) {
+        uint8_t skip = 0;
+        uint8_t count;
+        if (type == SSD1306_VIDEO_KEYFRAME) {
+            count = (uint8_t)((end - pos) < SSD1306_VIDEO_READ_CHUNK ? (end - pos) : SSD1306_VIDEO_READ_CHUNK);
+        } else {
+            const uint8_t* run = ssd1306_Video_Peek(video, pos, 2);
+            if (!run) return false;
+            skip = run[0];
+            count = run[1];
+            pos += 2;
+        }
+        index = (uint16_t)(index + skip);
+        if (count == 0) continue;
+        if (index + count > SSD1306_VIDEO_FRAME_SIZE || pos + count > end) return false;
+
+        const uint8_t* bytes = ssd1306_Video_Peek(video, pos, count);
+        if (!bytes) return false;
+        // Page order bytes land on page aligned columns of the frame buffer.
+        for (uint8_t i = 0; i < count; i++, index++) {
+            ssd1306_WriteColumn((int16_t)(index & 127), (int16_t)((index >> 7) * 8), bytes[i], 0xFF);
+        }
+        pos += count;
+        written += count;
+    }
+    video->stats.last_decode_bytes = written;
+    ssd1306_Video_Advance(video, len);
+    return true;
+}
+
+// Sends the decoded frame, a frame that could not be sent is sent again by the next update.
+static bool ssd1306_Video_Show(ssd1306_video_t* video){
+    video->pending = !ssd1306_UpdateDirty();
+    if (video->pending) {
+        return false;
+    }
+    video->stats.frames_shown++;
+    return true;
+}
+
+bool ssd1306_Video_Update(ssd1306_video_t* video, uint32_t now_us){
+    if (ssd1306_Video_Ended(video)) {
+        return video->pending && ssd1306_Video_Show(video);
+    }
+    if (!video->started) {
+        video->started = true;
+        // Anchor the clock so that the next frame is due now.
+        video->start_us = now_us - (uint32_t)((uint64_t)video->next_frame * 1000000UL / video->fps);
+    }
+    // The last frame of a pass may be shown before the next pass starts on the clock.
+    int32_t elapsed = (int32_t)(now_us - video->start_us);
+    if (elapsed < 0) {
+        return video->pending && ssd1306_Video_Show(video);
+    }
+    // Passes missed entirely, e.g. while the caller stalled, are skipped instead of played back to back.
+    if (video->loop && video->next_frame == 0 && (uint32_t)elapsed >= ssd1306_Video_LoopUs(video)) {
+        uint32_t passes = (uint32_t)elapsed / ssd1306_Video_LoopUs(video);
+        video->start_us += passes * ssd1306_Video_LoopUs(video);
+        elapsed = (int32_t)(now_us - video->start_us);
+    }
+    uint32_t due = (uint32_t)((uint64_t)elapsed * video->fps / 1000000UL);
+    if (due < video->next_frame) {
+        return video->pending && ssd1306_Video_Show(video);
+    }
+    if (due >= video->frame_count) {
+        due = video->frame_count - 1;
+    }
+
+    // Find the last keyframe up to the due frame, the deltas before it never need decoding.
+    uint32_t scan = video->offset;
+    uint32_t key_offset = 0;
+    uint32_t key_frame = 0;
+    bool key_found = false;
+    uint8_t type = 0;
+    uint16_t len = 0;
+    if (due > video->next_frame && !ssd1306_Video_FrameHeader(video, scan, &type, &len)) return false;
+    for (uint32_t f = video->next_frame + 1; f <= due; f++) {
+        scan += 3u + len;
+        if (!ssd1306_Video_FrameHeader(video, scan, &type, &len)) return false;
+        if (type == SSD1306_VIDEO_KEYFRAME) {
+            key_found = true;
+            key_offset = scan;
+            key_frame = f;
+        }
+    }
+    if (key_found) {
+        video->stats.frames_skipped += key_frame - video->next_frame;
+        video->stats.frames_dropped += key_frame - video->next_frame;
+        video->offset = key_offset;
+        video->next_frame = key_frame;
+    }
+
+    // A frame that could not be sent is superseded by the due one.
+    if (video->pending) {
+        video->stats.frames_dropped++;
+    }
+    uint32_t target = due;
+    uint32_t written = 0;
+    while (video->next_frame <= target) {
+        bool last = video->next_frame == target;
+        uint32_t before = video->next_frame;
+        if (!ssd1306_Video_DecodeNext(video)) return false;
+        written += video->stats.last_decode_bytes;
+        if (!last) video->stats.frames_dropped++;
+        // A looping stream wrapped back to frame 0.
+        if (video->next_frame < before) break;
+    }
+    video->stats.last_decode_bytes = written;
+    return ssd1306_Video_Show(video);
+}
+
+bool ssd1306_Video_Ended(const ssd1306_video_t* video){
+    return !video->loop && video->next_frame >= video->frame_count;
+}
+
+uint16_t ssd1306_Video_EncodeDelta(const uint8_t* prev, const uint8_t* cur, uint8_t* out){
+    uint32_t n = 0;
+    uint32_t i = 0;
+    uint32_t skip = 0;
+    while (i < SSD1306_VIDEO_FRAME_SIZE) {
+        if (prev[i] == cur[i]) {
+            skip++;
+            i++;
+            continue;
+        }
+        while (skip > 254) {
+            if (n + 2 >= SSD1306_VIDEO_FRAME_SIZE) return SSD1306_VIDEO_FRAME_SIZE;
+            out[n++] = 255;
+            out[n++] = 0;
+            skip -= 255;
+        }
+        // Short unchanged gaps are folded into the run, a new run header costs two bytes.
+        uint32_t start = i;
+        uint32_t last_change = i;
+        while (i < SSD1306_VIDEO_FRAME_SIZE && i - start < 255) {
+            if (prev[i] != cur[i]) last_change = i;
+            else if (i - last_change > 2) break;
+            i++;
+        }
+        uint32_t count = last_change - start + 1;
+        i = last_change + 1;
+        if (n + 2 + count >= SSD1306_VIDEO_FRAME_SIZE) return SSD1306_VIDEO_FRAME_SIZE;
+        out[n++] = (uint8_t)skip;
+        out[n++] = (uint8_t)count;
+        memcpy(&out[n], &cur[start], count);
+        n += count;
+        skip = 0;
+    }
+    return (uint16_t)n;
+}
@@ -0,0 +1,139 @@
+/*
+*   ssd1306_video.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_VIDEO_H
+#define SSD1306_VIDEO_H
+
+#include "ssd1306.h"
+
+/**
+ * Stream layout, as produced by tools/ssd1306_video_encode.c. Multi byte fields are little endian.
+ *  - Header, SSD1306_VIDEO_HEADER_SIZE bytes: "S1VD", version, width, height, fps, frame count (4 bytes), 4 reserved bytes.
+ *  - Frames: type ('K' keyframe or 'D' delta), payload length (2 bytes), payload.
+ *    A keyframe payload is the 1024 byte frame in page order. A delta payload is a list of (skip, count, count bytes)
+ *    runs that replace the bytes of the previous frame, a (255, 0) run only skips.
+ */
+#define SSD1306_VIDEO_HEADER_SIZE   16
+#define SSD1306_VIDEO_VERSION       1
+#define SSD1306_VIDEO_KEYFRAME      'K'
+#define SSD1306_VIDEO_DELTA         'D'
+#define SSD1306_VIDEO_FRAME_SIZE    1024
+
+#ifndef SSD1306_VIDEO_READ_CHUNK
+#define SSD1306_VIDEO_READ_CHUNK    64  // Bytes read at a time from a read callback source.
+#endif
+
+/**
+ * @brief  Reads bytes of the stream, for sources that are not memory mapped (SD card, external flash).
+ * @param  ctx User context passed to ssd1306_Video_OpenReader().
+ * @param  offset Byte offset in the stream.
+ * @param  dst Pointer to the destination.
+ * @param  len Number of bytes to read.
+ * @retval Number of bytes read, less than len only at the end of the stream.
+ */
+typedef uint16_t (*ssd1306_video_read_t)(void* ctx, uint32_t offset, uint8_t* dst, uint16_t len);
+
+/**
+ * @brief Playback statistics.
+ */
+typedef struct {
+    uint32_t frames_shown;      /**< Frames sent to the display */
+    uint32_t frames_dropped;    /**< Frames decoded or skipped without being sent because playback was behind */
+    uint32_t frames_skipped;    /**< Delta frames not decoded at all thanks to a later keyframe */
+    uint32_t last_decode_bytes; /**< Frame buffer bytes written by the last update */
+} ssd1306_video_stats_t;
+
+typedef struct {
+    const uint8_t*        data;         /**< Memory mapped stream, NULL when a read callback is used */
+    uint32_t              size;         /**< Size of the stream in bytes */
+    ssd1306_video_read_t  read;         /**< Read callback, used when data is NULL */
+    void*                 read_ctx;
+    uint8_t               chunk[SSD1306_VIDEO_READ_CHUNK];
+    uint32_t              chunk_offset; /**< Stream offset of chunk[0] */
+    uint16_t              chunk_len;
+    uint32_t              first_frame;  /**< Offset of the first frame */
+    uint32_t              offset;       /**< Offset of the next frame to decode */
+    uint32_t              next_frame;   /**< Index of the next frame to decode */
+    uint32_t              frame_count;
+    uint8_t               fps;
+    bool                  loop;
+    bool                  started;
+    bool                  pending;      /**< The last decoded frame has not been sent yet */
+    uint32_t              start_us;
+    ssd1306_video_stats_t stats;
+    bool                  mapped;       /**< The stream was mapped by ssd1306_Video_OpenFile() */
+} ssd1306_video_t;
+
+/**
+ * @brief  Opens a stream that is fully addressable in memory, e.g. in internal flash.
+ * @param  video Pointer to the player.
+ * @param  data Pointer to the stream.
+ * @param  size Size of the stream in bytes.
+ * @param  loop true to restart from the first frame at the end.
+ * @retval true if the header is valid, false otherwise.
+ */
+bool ssd1306_Video_OpenMemory(ssd1306_video_t* video, const uint8_t* data, uint32_t size, bool loop);
+
+/**
+ * @brief  Opens a stream read through a callback.
+ * @param  video Pointer to the player.
+ * @param  read The read callback.
+ * @param  ctx User context for the callback.
+ * @param  loop true to restart from the first frame at the end.
+ * @retval true if the header is valid, false otherwise.
+ */
+bool ssd1306_Video_OpenReader(ssd1306_video_t* video, ssd1306_video_read_t read, void* ctx, bool loop);
+
+#ifdef __linux__
+/**
+ * @brief  Opens a stream file through mmap.
+ * @param  video Pointer to the player.
+ * @param  path Path to the stream file.
+ * @param  loop true to restart from the first frame at the end.
+ * @retval true if the file has been mapped and the header is valid, false otherwise.
+ */
+bool ssd1306_Video_OpenFile(ssd1306_video_t* video, const char* path, bool loop);
+#endif
+
+/**
+ * @brief  Releases the stream, unmapping it if it was opened with ssd1306_Video_OpenFile().
+ * @param  video Pointer to the player.
+ */
+void ssd1306_Video_Close(ssd1306_video_t* video);
+
+/**
+ * @brief  Brings the display to the frame due at now_us. Frames that are already late are decoded without being sent,
+ *         and deltas before a due keyframe are not decoded at all. The result is sent with ssd1306_UpdateDirty(), a
+ *         frame that could not be sent is sent again by the next call until a later frame is due.
+ * @param  video Pointer to the player.
+ * @param  now_us Current time in microseconds, the first call starts the playback.
+ * @retval true if a frame has been sent, false if none was due, the stream ended or sending failed.
+ */
+bool ssd1306_Video_Update(ssd1306_video_t* video, uint32_t now_us);
+
+/**
+ * @brief  Decodes the next frame into the frame buffer without any pacing or sending.
+ * @param  video Pointer to the player.
+ * @retval true if a frame has been decoded, false at the end of the stream or on a malformed frame.
+ */
+bool ssd1306_Video_DecodeNext(ssd1306_video_t* video);
+
+/**
+ * @brief  Tells if the playback reached the end of a stream that does not loop.
+ * @param  video Pointer to the player.
+ * @retval true if there are no more frames, false otherwise.
+ */
+bool ssd1306_Video_Ended(const ssd1306_video_t* video);
+
+/**
+ * @brief  Encodes the bytes of a frame that differ from the previous frame as delta runs, for offline or host side use.
+ * @param  prev Pointer to the previous 1024 byte frame.
+ * @param  cur Pointer to the 1024 byte frame to encode.
+ * @param  out Pointer to SSD1306_VIDEO_FRAME_SIZE bytes for the delta payload.
+ * @retval Payload size, SSD1306_VIDEO_FRAME_SIZE if a keyframe would not be larger than the delta.
+ */
+uint16_t ssd1306_Video_EncodeDelta(const uint8_t* prev, const uint8_t* cur, uint8_t* out);
+
+#endif // SSD1306_VIDEO_H
@@ -0,0 +1,297 @@
+/*
+*   ssd1306_worker.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifdef SSD1306_USE_HOST
+#define _POSIX_C_SOURCE 200809L // clock_gettime() and pthread_condattr_setclock() under -std=c11.
+#endif
+
+#include "ssd1306_worker.h"
+#include <string.h>
+
+#if defined(SSD1306_WORKER_PTHREAD)
+#include <pthread.h>
+#include <time.h>
+#elif defined(SSD1306_WORKER_FREERTOS)
+#if defined(SSD1306_USE_ESP_IDF) || defined(SSD1306_USE_ESP_ARDUINO)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#else
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+#endif
+
+static ssd1306_frames_t* source = NULL;
+static uint32_t period_us = 0;
+static uint32_t next_slot_us = 0;
+static bool started = false;
+
+// Frame taken from the handoff whose transfer could not be started yet.
+static const uint8_t* pending = NULL;
+// Hash of the frame on screen, for skipping unchanged frames without keeping a copy of it.
+static uint32_t shown_hash = 0;
+static bool shown = false;
+
+static uint32_t last_send_us = 0;
+static uint64_t jitter_sum_us = 0;
+static uint32_t jitter_count = 0;
+static uint32_t merged_base = 0;
+static ssd1306_worker_stats_t stats;
+
+/**
+ * @brief  FNV-1a hash of a frame.
+ */
+static uint32_t ssd1306_Worker_Hash(const uint8_t* frame){
+    uint32_t hash = 2166136261u;
+    for (uint16_t i = 0; i < SSD1306_FRAME_SIZE; i++) {
+        hash = (hash ^ frame[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool ssd1306_Worker_Init(ssd1306_frames_t* frames, uint16_t fps){
+    if (!frames || fps == 0) {
+        return false;
+    }
+    source = frames;
+    period_us = 1000000UL / fps;
+    started = false;
+    pending = NULL;
+    shown = false;
+    jitter_sum_us = 0;
+    jitter_count = 0;
+    ssd1306_frames_stats_t frame_stats;
+    ssd1306_Frames_GetStats(frames, &frame_stats);
+    merged_base = frame_stats.dropped;
+    memset(&stats, 0, sizeof(stats));
+    return true;
+}
+
+uint32_t ssd1306_Worker_Poll(uint32_t now_us){
+    if (!source) {
+        return SSD1306_WORKER_IDLE;
+    }
+    if (!started) {
+        started = true;
+        next_slot_us = now_us;
+    }
+    if ((int32_t)(now_us - next_slot_us) < 0) {
+        // Frames published before the slot replace each other in the handoff and go out as one transfer.
+        return next_slot_us - now_us;
+    }
+    // The transfer in flight reads the front buffer, which goes back to the renderer with the next take.
+    if (!ssd1306_platform_is_dma_done()) {
+        return SSD1306_WORKER_DMA_POLL_US;
+    }
+    const uint8_t* frame = ssd1306_Frames_Take(source);
+    if (frame) {
+        pending = frame;
+    }
+    if (!pending) {
+        return SSD1306_WORKER_IDLE;
+    }
+    uint32_t hash = ssd1306_Worker_Hash(pending);
+    if (shown && hash == shown_hash) {
+        pending = NULL;
+        stats.frames_skipped++;
+        return SSD1306_WORKER_IDLE;
+    }
+    if (!ssd1306_SendFrame(pending)) {
+        return SSD1306_WORKER_DMA_POLL_US;
+    }
+    pending = NULL;
+    shown_hash = hash;
+    stats.frames_sent++;
+
+    // Jitter is taken over transfers that follow each other within two periods, a pause in the stream is not jitter.
+    uint32_t interval = now_us - last_send_us;
+    if (shown && interval < 2 * period_us) {
+        uint32_t deviation = interval > period_us ? interval - period_us : period_us - interval;
+        if (deviation > stats.jitter_max_us) {
+            stats.jitter_max_us = deviation;
+        }
+        jitter_sum_us += deviation;
+        jitter_count++;
+        stats.jitter_avg_us = (uint32_t)(jitter_sum_us / jitter_count);
+    }
+    shown = true;
+    last_send_us = now_us;
+
+    // Slots keep their cadence while frames keep coming, after a pause the next slot counts from this transfer.
+    next_slot_us += period_us;
+    if ((int32_t)(now_us - next_slot_us) >= 0) {
+        next_slot_us = now_us + period_us;
+    }
+    return next_slot_us - now_us;
+}
+
+void ssd1306_Worker_GetStats(ssd1306_worker_stats_t* out){
+    *out = stats;
+    if (source) {
+        ssd1306_frames_stats_t frame_stats;
+        ssd1306_Frames_GetStats(source, &frame_stats);
+        out->frames_merged = frame_stats.dropped - merged_base;
+    }
+}
+
+#if defined(SSD1306_WORKER_PTHREAD)
+
+static pthread_t thread;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake;
+static bool running = false;
+static bool signaled = false;
+
+static uint32_t ssd1306_Worker_NowUs(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+static void* ssd1306_Worker_Thread(void* arg){
+    (void)arg;
+    pthread_mutex_lock(&lock);
+    while (running) {
+        signaled = false;
+        pthread_mutex_unlock(&lock);
+        uint32_t wait_us = ssd1306_Worker_Poll(ssd1306_Worker_NowUs());
+        pthread_mutex_lock(&lock);
+        // A frame published while polling is picked up straight away.
+        if (!running || signaled) {
+            continue;
+        }
+        if (wait_us == SSD1306_WORKER_IDLE) {
+            pthread_cond_wait(&wake, &lock);
+        } else {
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            uint64_t ns = (uint64_t)deadline.tv_nsec + (uint64_t)wait_us * 1000u;
+            deadline.tv_sec += (time_t)(ns / 1000000000u);
+            deadline.tv_nsec = (long)(ns % 1000000000u);
+            pthread_cond_timedwait(&wake, &lock, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+bool ssd1306_Worker_Start(ssd1306_frames_t* frames, uint16_t fps){
+    if (running || !ssd1306_Worker_Init(frames, fps)) {
+        return false;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&wake, &attr);
+    pthread_condattr_destroy(&attr);
+    running = true;
+    signaled = false;
+    if (pthread_create(&thread, NULL, ssd1306_Worker_Thread, NULL) != 0) {
+        running = false;
+        pthread_cond_destroy(&wake);
+        return false;
+    }
+    return true;
+}
+
+void ssd1306_Worker_FrameReady(void){
+    pthread_mutex_lock(&lock);
+    if (running) {
+        signaled = true;
+        pthread_cond_signal(&wake);
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+bool ssd1306_Worker_Stop(void){
+    pthread_mutex_lock(&lock);
+    if (!running) {
+        pthread_mutex_unlock(&lock);
+        return false;
+    }
+    running = false;
+    pthread_cond_signal(&wake);
+    pthread_mutex_unlock(&lock);
+    pthread_join(thread, NULL);
+    pthread_cond_destroy(&wake);
+    return true;
+}
+
+#elif defined(SSD1306_WORKER_FREERTOS)
+
+static TaskHandle_t task = NULL;
+static volatile bool running = false;
+
+static uint32_t ssd1306_Worker_NowUs(void){
+#if defined(SSD1306_USE_ESP_IDF) || defined(SSD1306_USE_ESP_ARDUINO)
+    return (uint32_t)esp_timer_get_time();
+#else
+    return (uint32_t)((uint64_t)xTaskGetTickCount() * 1000000ULL / configTICK_RATE_HZ);
+#endif
+}
+
+static void ssd1306_Worker_Task(void* arg){
+    (void)arg;
+    while (running) {
+        uint32_t wait_us = ssd1306_Worker_Poll(ssd1306_Worker_NowUs());
+        TickType_t ticks = portMAX_DELAY;
+        if (wait_us != SSD1306_WORKER_IDLE) {
+            // Round up so a short wait does not turn into a busy loop.
+            ticks = (TickType_t)(((uint64_t)wait_us * configTICK_RATE_HZ + 999999u) / 1000000u);
+        }
+        ulTaskNotifyTake(pdTRUE, ticks);
+    }
+    task = NULL;
+    vTaskDelete(NULL);
+}
+
+bool ssd1306_Worker_Start(ssd1306_frames_t* frames, uint16_t fps){
+    if (task || !ssd1306_Worker_Init(frames, fps)) {
+        return false;
+    }
+    running = true;
+    if (xTaskCreate(ssd1306_Worker_Task, "ssd1306", SSD1306_WORKER_STACK_SIZE, NULL, SSD1306_WORKER_PRIORITY, &task) != pdPASS) {
+        running = false;
+        task = NULL;
+        return false;
+    }
+    return true;
+}
+
+void ssd1306_Worker_FrameReady(void){
+    TaskHandle_t t = task;
+    if (t) {
+        xTaskNotifyGive(t);
+    }
+}
+
+bool ssd1306_Worker_Stop(void){
+    TaskHandle_t t = task;
+    if (!t) {
+        return false;
+    }
+    // The task deletes itself once it sees the flag.
+    running = false;
+    xTaskNotifyGive(t);
+    return true;
+}
+
+#else
+
+bool ssd1306_Worker_Start(ssd1306_frames_t* frames, uint16_t fps){
+    (void)frames;
+    (void)fps;
+    return false;
+}
+
+void ssd1306_Worker_FrameReady(void){
+}
+
+bool ssd1306_Worker_Stop(void){
+    return false;
+}
+
+#endif
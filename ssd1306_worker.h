@@ -0,0 +1,101 @@
+/*
+*   ssd1306_worker.h
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*/
+#ifndef SSD1306_WORKER_H
+#define SSD1306_WORKER_H
+
+#include "ssd1306_frames.h"
+
+/*
+ * Flush worker. Frames published through a ssd1306_frames_t handoff are sent at no more than a target frame rate:
+ * frames published faster are merged into the newest one, frames identical to the one on screen are not sent, and
+ * the UI never waits for the bus. ssd1306_Worker_Poll() does the work and can be called from a main loop; where the
+ * platform has threads, ssd1306_Worker_Start() runs it in a driver owned task that sleeps until a frame is ready
+ * or its slot comes up:
+ *  - SSD1306_USE_HOST: a pthread.
+ *  - SSD1306_USE_ESP_IDF, SSD1306_USE_ESP_ARDUINO, or SSD1306_USE_FREERTOS on STM32: a FreeRTOS task.
+ *
+ * Renderer side:
+ *
+ *   ssd1306_Frames_Publish(&frames);
+ *   ssd1306_Worker_FrameReady();
+ */
+
+#if defined(SSD1306_USE_HOST)
+#define SSD1306_WORKER_PTHREAD
+#elif defined(SSD1306_USE_ESP_IDF) || defined(SSD1306_USE_ESP_ARDUINO) || defined(SSD1306_USE_FREERTOS)
+#define SSD1306_WORKER_FREERTOS
+#endif
+
+#ifndef SSD1306_WORKER_STACK_SIZE
+#define SSD1306_WORKER_STACK_SIZE 2048  // FreeRTOS task stack, in the units of xTaskCreate().
+#endif
+
+#ifndef SSD1306_WORKER_PRIORITY
+#define SSD1306_WORKER_PRIORITY   2     // FreeRTOS task priority.
+#endif
+
+#ifndef SSD1306_WORKER_DMA_POLL_US
+#define SSD1306_WORKER_DMA_POLL_US 1000 // Interval to check a transfer in flight for completion.
+#endif
+
+/**
+ * @brief Returned by ssd1306_Worker_Poll() when there is nothing to do until the next frame is published.
+ */
+#define SSD1306_WORKER_IDLE 0xFFFFFFFFu
+
+/**
+ * @brief Flush statistics, as measured by ssd1306_Worker_Poll().
+ */
+typedef struct {
+    uint32_t frames_sent;    /**< Frame transfers started */
+    uint32_t frames_merged;  /**< Frames replaced by a newer one before their slot, never sent */
+    uint32_t frames_skipped; /**< Frames identical to the one on screen, not sent */
+    uint32_t jitter_max_us;  /**< Largest deviation of the interval between consecutive transfers from the frame period */
+    uint32_t jitter_avg_us;  /**< Mean deviation of the interval between consecutive transfers from the frame period */
+} ssd1306_worker_stats_t;
+
+/**
+ * @brief  Sets up the worker state for ssd1306_Worker_Poll() without starting a task.
+ * @param  frames Pointer to the handoff the frames are taken from.
+ * @param  fps Target frame rate, the upper bound for transfers per second.
+ * @retval true if the worker has been set up, false otherwise.
+ */
+bool ssd1306_Worker_Init(ssd1306_frames_t* frames, uint16_t fps);
+
+/**
+ * @brief  Sends the newest published frame if its slot has come, the bus is free and it differs from the frame on screen.
+ * @param  now_us Current time in microseconds, wrapping is handled.
+ * @retval Microseconds until the next call is useful, SSD1306_WORKER_IDLE to wait for the next published frame.
+ */
+uint32_t ssd1306_Worker_Poll(uint32_t now_us);
+
+/**
+ * @brief  Sets up the worker and starts the driver owned flush task. Only available on platforms with threads.
+ * @param  frames Pointer to the handoff the frames are taken from.
+ * @param  fps Target frame rate, the upper bound for transfers per second.
+ * @retval true if the task has been started, false if it is already running or cannot be created.
+ */
+bool ssd1306_Worker_Start(ssd1306_frames_t* frames, uint16_t fps);
+
+/**
+ * @brief  Wakes the flush task after a frame has been published, does nothing when no task is running.
+ *         Safe to call from any task, never blocks on the bus.
+ */
+void ssd1306_Worker_FrameReady(void);
+
+/**
+ * @brief  Stops the flush task. A transfer in flight is left to complete.
+ * @retval true if the task has been stopped, false if it was not running.
+ */
+bool ssd1306_Worker_Stop(void);
+
+/**
+ * @brief  Provides the flush statistics since ssd1306_Worker_Init() or ssd1306_Worker_Start().
+ * @param  stats Pointer to the structure to fill.
+ */
+void ssd1306_Worker_GetStats(ssd1306_worker_stats_t* stats);
+
+#endif // SSD1306_WORKER_H
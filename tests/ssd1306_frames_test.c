@@ -0,0 +1,155 @@
+/*
+*   ssd1306_frames_test.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*
+*   Stress test of the triple buffer handoff. A renderer thread publishes numbered frames as fast as it can while a
+*   flusher thread takes them; every frame taken must be complete (no byte from another frame), newer than the last
+*   one, and every published frame must be either taken or dropped. Prints the publish to take latency histogram.
+*   The flush path is then checked on the simulated display with a slow bus.
+*   Usage: ssd1306_frames_test [frames]
+*/
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ssd1306_frames.h"
+
+#define HISTOGRAM_BUCKETS 24
+
+static ssd1306_frames_t frames;
+static uint8_t storage[3 * SSD1306_FRAME_SIZE];
+static uint32_t frame_count = 200000;
+static bool render_done;
+
+static uint32_t torn_frames;
+static uint32_t out_of_order;
+static uint32_t latency_histogram[HISTOGRAM_BUCKETS];
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+// Frame layout: sequence number, publish time, then the low byte of the sequence number in every other byte.
+static void* renderer(void* arg){
+    (void)arg;
+    for (uint32_t seq = 1; seq <= frame_count; seq++) {
+        uint8_t* frame = ssd1306_Frames_Back(&frames);
+        memset(frame + 12, (int)(seq & 0xFF), SSD1306_FRAME_SIZE - 12);
+        // Give the flusher a chance to run in the middle of a frame, also on a single core.
+        if ((seq & 3) == 0) sched_yield();
+        memcpy(frame, &seq, 4);
+        uint64_t t = now_ns();
+        memcpy(frame + 4, &t, 8);
+        ssd1306_Frames_Publish(&frames);
+    }
+    __atomic_store_n(&render_done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void* flusher(void* arg){
+    (void)arg;
+    uint32_t last_seq = 0;
+    for (;;) {
+        bool done = __atomic_load_n(&render_done, __ATOMIC_ACQUIRE);
+        const uint8_t* frame = ssd1306_Frames_Take(&frames);
+        if (!frame) {
+            if (done) break;    // The last publish happened before done was set, nothing is left.
+            sched_yield();
+            continue;
+        }
+        uint64_t t = now_ns();
+        uint32_t seq;
+        uint64_t published;
+        memcpy(&seq, frame, 4);
+        memcpy(&published, frame + 4, 8);
+        for (uint16_t i = 12; i < SSD1306_FRAME_SIZE; i++) {
+            if (frame[i] != (uint8_t)seq) {
+                torn_frames++;
+                break;
+            }
+        }
+        if (seq <= last_seq) out_of_order++;
+        last_seq = seq;
+        // Bucket b holds latencies below 2^b ns.
+        uint64_t latency = t - published;
+        uint8_t bucket = 0;
+        while (bucket < HISTOGRAM_BUCKETS - 1 && (latency >> bucket) != 0) bucket++;
+        latency_histogram[bucket]++;
+    }
+    return NULL;
+}
+
+static int check_stress(void){
+    ssd1306_Frames_Init(&frames, storage);
+    pthread_t render_thread, flush_thread;
+    pthread_create(&flush_thread, NULL, flusher, NULL);
+    pthread_create(&render_thread, NULL, renderer, NULL);
+    pthread_join(render_thread, NULL);
+    pthread_join(flush_thread, NULL);
+
+    ssd1306_frames_stats_t stats;
+    ssd1306_Frames_GetStats(&frames, &stats);
+    printf("published %lu, taken %lu, dropped %lu, torn %lu, out of order %lu\n",
+           (unsigned long)stats.published, (unsigned long)stats.taken, (unsigned long)stats.dropped,
+           (unsigned long)torn_frames, (unsigned long)out_of_order);
+    printf("publish to take latency:\n");
+    for (uint8_t b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        if (latency_histogram[b])
+            printf("  < %8llu ns  %lu\n", 1ULL << b, (unsigned long)latency_histogram[b]);
+    }
+    int failures = 0;
+    if (torn_frames || out_of_order) failures++;
+    if (stats.published != frame_count || stats.taken + stats.dropped != frame_count) {
+        printf("FAIL frames lost: taken + dropped != published\n");
+        failures++;
+    }
+    return failures;
+}
+
+// A frame published while the bus is busy waits, frames published meanwhile collapse into the newest one.
+static int check_flush(void){
+    ssd1306_platform_init(0x3C);
+    ssd1306_Init();
+    ssd1306_Frames_Init(&frames, storage);
+    ssd1306_host_set_dma_bus_hz(400000);
+    ssd1306_host_set_time_us(0);
+    int failures = 0;
+
+    memset(ssd1306_Frames_Back(&frames), 0x11, SSD1306_FRAME_SIZE);
+    ssd1306_Frames_Publish(&frames);
+    if (!ssd1306_Frames_Flush(&frames)) failures++;
+    for (uint8_t v = 2; v <= 4; v++) {
+        memset(ssd1306_Frames_Back(&frames), v * 0x11, SSD1306_FRAME_SIZE);
+        ssd1306_Frames_Publish(&frames);
+    }
+    if (ssd1306_Frames_Flush(&frames)) failures++;     // The first frame is still on the wire.
+    ssd1306_host_set_time_us(30000);
+    if (!ssd1306_Frames_Flush(&frames)) failures++;
+    ssd1306_host_set_time_us(60000);
+    if (ssd1306_Frames_Flush(&frames)) failures++;     // Nothing new.
+    if (ssd1306_host_gddram()[0] != 0x44 || ssd1306_host_gddram()[SSD1306_FRAME_SIZE - 1] != 0x44) failures++;
+
+    ssd1306_frames_stats_t stats;
+    ssd1306_Frames_GetStats(&frames, &stats);
+    if (stats.published != 4 || stats.taken != 2 || stats.dropped != 2) failures++;
+    ssd1306_host_set_dma_bus_hz(0);
+    printf("flush on a busy bus: %s\n", failures ? "FAIL" : "ok");
+    return failures;
+}
+
+int main(int argc, char** argv){
+    if (argc > 1) {
+        frame_count = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+    int failures = check_stress() + check_flush();
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,682 @@
+/*
+*   ssd1306_golden_test.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*
+*   Golden frame regression test. Each scene is drawn and flushed through the public API, the panel is rendered
+*   from the emulated GDDRAM of the simulated display and compared against tests/golden/<scene>.pbm.
+*   A scene also fails when its pixel operations or bus bytes exceed the budget in tests/golden/budgets.txt.
+*   Usage: ssd1306_golden_test [--update] golden_dir
+*   --update rewrites the golden images and sets the budgets to the measured cost.
+*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306.h"
+#include "ssd1306_console.h"
+#include "ssd1306_chart.h"
+#include "ssd1306_canvas.h"
+#include "ssd1306_dither.h"
+#include "ssd1306_text.h"
+#include "ssd1306_scale.h"
+
+#define WIDTH  128
+#define HEIGHT 64
+#define MAX_SCENES 32
+
+typedef void (*scene_fn_t)(void);
+
+typedef struct {
+    const char* name;
+    scene_fn_t  draw;
+} scene_t;
+
+typedef struct {
+    char     name[32];
+    uint32_t pixel_ops;
+    uint32_t bus_bytes;
+} budget_t;
+
+// Scenes. Each one starts from a freshly initialised, flushed display.
+
+static void scene_text(void){
+    char line[22];
+    for (uint8_t row = 0; row < 5; row++) {
+        for (uint8_t i = 0; i < 21; i++) {
+            uint8_t ch = (uint8_t)(32 + row * 21 + i);
+            line[i] = (char)(ch > 127 ? ' ' : ch);
+        }
+        ssd1306_WriteString(0, (int16_t)(row * 9), line, 21, Font_5x8, true);
+    }
+    ssd1306_FillRect(0, 48, 128, 16, true);
+    ssd1306_WriteString(3, 52, "Inverted text", 13, Font_5x8, false);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_lines(void){
+    ssd1306_DrawLine(0, 0, 127, 0, 1, true);
+    ssd1306_DrawLine(0, 4, 60, 4, 3, true);
+    ssd1306_DrawLine(4, 10, 4, 60, 3, true);
+    ssd1306_DrawLine(12, 10, 60, 60, 2, true);
+    ssd1306_DrawLine(70, 60, 127, 10, 2, true);
+    ssd1306_DrawLine(70, 10, 90, 63, 4, true);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_rects(void){
+    ssd1306_DrawRect(0, 0, 40, 30, 1, true);
+    ssd1306_DrawRect(44, 0, 40, 30, 3, true);
+    ssd1306_DrawRect(88, 0, 10, 10, 6, true);
+    ssd1306_FillRect(0, 34, 60, 30, true);
+    ssd1306_FillRect(10, 40, 20, 10, false);
+    ssd1306_DrawRect(64, 34, 64, 30, 2, true);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_circles(void){
+    ssd1306_DrawCircle(16, 16, 15, 1, true);
+    ssd1306_DrawCircle(50, 16, 15, 4, true);
+    ssd1306_FillCircle(84, 16, 15, true);
+    ssd1306_FillCircle(84, 16, 6, false);
+    ssd1306_DrawCircle(115, 50, 20, 2, true);
+    ssd1306_DrawCircle(20, 50, 3, 5, true);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_polys(void){
+    int16_t tx[3] = { 10, 60, 20 };
+    int16_t ty[3] = { 5, 20, 60 };
+    int16_t sx[5] = { 96, 120, 111, 81, 72 };
+    int16_t sy[5] = { 4, 22, 52, 52, 22 };
+    ssd1306_FillPoly(tx, ty, 3, true);
+    ssd1306_DrawPoly(sx, sy, 5, 1, true);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_bitmap(void){
+    static uint8_t bitmap[32 * 4];
+    for (uint8_t i = 0; i < 32; i++) {
+        for (uint8_t p = 0; p < 4; p++) {
+            bitmap[p * 32 + i] = (uint8_t)(((i + p) & 1) ? 0xAA : 0x55) ^ (uint8_t)(i * 7);
+        }
+    }
+    ssd1306_DrawBitmap(3, 5, bitmap, 32, 32, true);
+    ssd1306_DrawBitmap(50, 21, bitmap, 32, 20, true);
+    ssd1306_FillRect(90, 0, 38, 64, true);
+    ssd1306_DrawBitmap(93, 13, bitmap, 32, 32, false);
+    ssd1306_UpdateScreen();
+}
+
+static void scene_dirty(void){
+    ssd1306_DrawRect(0, 0, 128, 64, 1, true);
+    ssd1306_UpdateScreen();
+    // Only the changed regions go through UpdateDirty(), a wrong window shows up in GDDRAM.
+    ssd1306_WriteString(10, 13, "dirty", 5, Font_5x8, true);
+    ssd1306_FillRect(100, 40, 9, 17, true);
+    ssd1306_UpdateDirty();
+    ssd1306_FillRect(102, 44, 3, 3, false);
+    ssd1306_UpdateDirty();
+}
+
+static void scene_scroll(void){
+    for (uint8_t row = 0; row < 8; row++) {
+        char text[8];
+        snprintf(text, sizeof(text), "row %u", row);
+        ssd1306_WriteString(0, (int16_t)(row * 8), text, (uint8_t)strlen(text), Font_5x8, true);
+    }
+    ssd1306_UpdateScreen();
+    ssd1306_ScrollFrame(13, false);
+    ssd1306_WriteString(60, 51, "new", 3, Font_5x8, true);
+    ssd1306_DrawLine(0, 63, 127, 63, 1, true);
+    ssd1306_UpdateDirty();
+}
+
+// Ring scroll flushed through a background transfer on a simulated 400 kHz bus. The start line must wait until the
+// exposed rows are on the wire and is applied by ssd1306_FlushPoll(); a scene that stops early leaves the old line.
+static void scene_scroll_dma(void){
+    uint32_t now_us = 0;
+    ssd1306_host_set_time_us(now_us);
+    ssd1306_host_set_dma_bus_hz(400000);
+    for (uint8_t row = 0; row < 8; row++) {
+        char text[8];
+        snprintf(text, sizeof(text), "dma %u", row);
+        ssd1306_WriteString(0, (int16_t)(row * 8), text, (uint8_t)strlen(text), Font_5x8, true);
+    }
+    bool ok = ssd1306_UpdateScreen();
+    ssd1306_host_set_time_us(now_us += 30000);
+    ok = ok && ssd1306_ScrollFrame(21, false);
+    ssd1306_WriteString(60, 51, "new", 3, Font_5x8, true);
+    ok = ok && ssd1306_UpdateScreen();
+    // The frame is still on the wire, the start line has not been sent yet.
+    ok = ok && !ssd1306_FlushPoll() && ssd1306_host_start_line() == 0;
+    ssd1306_host_set_time_us(now_us += 30000);
+    if (ok)
+        ssd1306_FlushPoll();
+    ssd1306_host_set_dma_bus_hz(0);
+}
+
+// Command list framing. The list is sent once the way the backends used to split it, the first byte under 0x00 and
+// the rest under Co = 1, which the controller misreads and the simulated display rejects, then as one transaction
+// under 0x00. Only the second one inverts the panel.
+static void scene_framing(void){
+    static const uint8_t list[] = { 0xA6, 0xA7, 0x81, 0x10 };
+    ssd1306_WriteString(4, 4, "framing", 7, Font_5x8, true);
+    ssd1306_FillRect(4, 20, 40, 20, true);
+    ssd1306_UpdateScreen();
+    bool ok = ssd1306_host_write_frame(0x00, list, 1) && !ssd1306_host_write_frame(0x80, &list[1], sizeof(list) - 1);
+    if (ok)
+        ssd1306_host_write_frame(0x00, &list[1], sizeof(list) - 1);
+}
+
+static void scene_console(void){
+    char text[24];
+    ssd1306_Console_Init(true);
+    for (uint8_t i = 0; i < 12; i++) {
+        snprintf(text, sizeof(text), "console line %u", i);
+        ssd1306_Console_PrintLine(text);
+    }
+}
+
+static void scene_chart(void){
+    ssd1306_chart_t chart;
+    ssd1306_WriteString(0, 0, "chart", 5, Font_5x8, true);
+    ssd1306_Chart_Init(&chart, 0, 10, 128, 48, 0, 100, true);
+    ssd1306_UpdateScreen();
+    for (uint16_t i = 0; i < 150; i++) {
+        ssd1306_Chart_Draw(&chart, (int32_t)((i * 37) % 101));
+    }
+    for (uint16_t i = 0; i < 10; i++) {
+        ssd1306_Chart_Push(&chart, (int32_t)(i * 11));
+    }
+}
+
+static void scene_area(void){
+    static uint8_t rows[24 * 6];
+    for (uint8_t r = 0; r < 24; r++) {
+        for (uint8_t b = 0; b < 6; b++) {
+            rows[r * 6 + b] = (uint8_t)((r & 4) ? 0xF0 >> (r & 3) : 0x81 << (r & 3)) ^ (uint8_t)(b * 0x11);
+        }
+    }
+    ssd1306_WriteString(0, 0, "area", 4, Font_5x8, true);
+    ssd1306_ScrollFrame(11, false);
+    ssd1306_UpdateDirty();
+    // An external renderer writes page bytes itself and reports the region.
+    uint8_t* fb = ssd1306_GetFramebuffer();
+    uint8_t page = (uint8_t)(((40 + ssd1306_GetScrollOffset()) & 63) >> 3);
+    for (uint8_t x = 100; x < 124; x++) fb[page * 128 + x] = 0x5A;
+    ssd1306_MarkDirty(100, 40, 24, 8);
+    ssd1306_UpdateDirty();
+    // Row major 1bpp, unaligned and wrapping around the bottom of the ring, sent through its own window.
+    ssd1306_WriteRowBitmap(13, 45, rows, 45, 19, 6);
+    ssd1306_WriteRowBitmap(70, 3, rows, 24, 24, 6);
+    ssd1306_UpdateArea(13, 45, 45, 19);
+    ssd1306_UpdateArea(70, 3, 24, 24);
+}
+
+// A 256x64 sign on two panels, drawn across the seam. The scene shows one of the two panels.
+static void canvas_scene(uint8_t shown){
+    static uint8_t sign_buffer[2 * 1024];
+    static ssd1306_canvas_t sign;
+    static const uint8_t sign_panels[] = { 0, 1 };
+    int16_t px[] = { 96, 176, 150 };
+    int16_t py[] = { 40, 34, 62 };
+    ssd1306_platform_init_panel(1, 0x3D);
+    ssd1306_Canvas_Init(&sign, sign_buffer, 2, 1, sign_panels);
+    ssd1306_Canvas_InitPanels(&sign);
+    ssd1306_SetTarget(&sign);
+    ssd1306_DrawRect(0, 0, 256, 64, 2, true);
+    ssd1306_WriteString(90, 6, "ACROSS THE SEAM", 15, Font_5x8, true);
+    ssd1306_DrawCircle(128, 26, 10, 1, true);
+    ssd1306_DrawLine(4, 60, 251, 18, 1, true);
+    ssd1306_FillPoly(px, py, 3, true);
+    ssd1306_XorColumn(127, 28, 0xFF);
+    ssd1306_XorColumn(128, 28, 0xFF);
+    ssd1306_SetTarget(NULL);
+    ssd1306_Canvas_Flush(&sign);
+    while (!ssd1306_Canvas_Poll(&sign)) { }
+    ssd1306_platform_select(shown);
+}
+
+static void scene_canvas_left(void){
+    canvas_scene(0);
+}
+
+static void scene_canvas_right(void){
+    canvas_scene(1);
+}
+
+static void scene_patterns(void){
+    int16_t px[] = { 70, 124, 110, 80 };
+    int16_t py[] = { 36, 40, 62, 58 };
+    ssd1306_pattern_t level;
+    ssd1306_FillRectPattern(2, 2, 40, 28, &ssd1306_pattern_gray50);
+    ssd1306_FillRectPattern(44, 5, 27, 23, &ssd1306_pattern_hatch);
+    ssd1306_Dither_Pattern(10, &level);
+    ssd1306_FillRectPattern(74, 2, 52, 13, &level);
+    ssd1306_FillRectPattern(74, 15, 52, 13, &ssd1306_pattern_gray75);
+    ssd1306_FillCirclePattern(30, 47, 15, &ssd1306_pattern_cross);
+    ssd1306_FillPolyPattern(px, py, 4, &ssd1306_pattern_gray25);
+    ssd1306_DrawLineStyle(0, 33, 127, 33, 1, true, SSD1306_LINE_DASHED);
+    ssd1306_DrawLineStyle(50, 36, 64, 63, 1, true, SSD1306_LINE_DOTTED);
+    ssd1306_DrawLineStyle(56, 36, 70, 63, 2, true, SSD1306_LINE_DASH_DOT);
+    ssd1306_UpdateScreen();
+}
+
+// Boundary fills of outlines, the first one flushed through the area it reports.
+static void scene_flood(void){
+    int16_t px[] = { 70, 124, 110, 84, 96 };
+    int16_t py[] = { 4, 10, 58, 60, 30 };
+    ssd1306_area_t bounds;
+    ssd1306_DrawCircle(30, 30, 24, 1, true);
+    ssd1306_DrawCircle(30, 30, 8, 1, true);
+    ssd1306_DrawLine(6, 30, 54, 30, 1, true);
+    ssd1306_DrawPoly(px, py, 5, 1, true);
+    ssd1306_WriteString(2, 56, "FLOOD", 5, Font_5x8, true);
+    ssd1306_UpdateScreen();
+    ssd1306_FloodFill(30, 12, true, NULL, 0, &bounds);
+    ssd1306_UpdateArea(bounds.x, bounds.y, bounds.w, bounds.h);
+    ssd1306_FloodFill(100, 40, true, NULL, 0, NULL);
+    ssd1306_FloodFill(30, 48, true, NULL, 0, NULL);
+    ssd1306_FloodFill(2, 57, false, NULL, 0, NULL);
+    ssd1306_UpdateDirty();
+}
+
+// Gauge with a thick arc band, ticks and a needle from the trig table, a pie and a turned rectangle.
+static void scene_gauge(void){
+    ssd1306_DrawArc(40, 40, 36, -30, 210, 1, true);
+    ssd1306_DrawArc(40, 40, 32, -30, 30, 4, true);
+    for (int16_t a = -30; a <= 210; a += 30)
+        ssd1306_DrawNeedle(40, 40, 26, 30, a, 1, true);
+    ssd1306_DrawNeedle(40, 40, -6, 28, 125, 5, true);
+    ssd1306_FillCircle(40, 40, 3, true);
+    ssd1306_WriteString(24, 54, "RPM", 3, Font_5x8, true);
+    ssd1306_UpdateScreen();
+    ssd1306_FillPie(104, 20, 18, 90, 330, true);
+    ssd1306_DrawArc(104, 20, 18, 0, 360, 1, true);
+    ssd1306_FillRectRotated(100, 52, 30, 8, 20, true);
+    ssd1306_DrawRectRotated(100, 52, 36, 14, 20, 1, true);
+    ssd1306_UpdateDirty();
+}
+
+// Static grid on the background, a moving box and trace on the foreground with a mask knocking out the grid under
+// the box. Each frame clears and redraws only the foreground, the composited changes go out with ssd1306_UpdateDirty().
+static void scene_layers(void){
+    static uint8_t back[1024], fore[1024], mask[1024];
+    ssd1306_SetLayers(back, fore, mask);
+    ssd1306_SelectLayer(SSD1306_LAYER_BACKGROUND);
+    for (int16_t x = 0; x < 128; x += 16)
+        ssd1306_DrawLineStyle(x, 0, x, 63, 1, true, SSD1306_LINE_DOTTED);
+    for (int16_t y = 0; y < 64; y += 16)
+        ssd1306_DrawLineStyle(0, y, 127, y, 1, true, SSD1306_LINE_DOTTED);
+    ssd1306_WriteString(92, 56, "GRID", 4, Font_5x8, true);
+    for (int16_t frame = 0; frame < 3; frame++) {
+        ssd1306_SelectLayer(SSD1306_LAYER_FOREGROUND);
+        ssd1306_Clear();
+        ssd1306_DrawRect((int16_t)(20 + frame * 15), 20, 30, 16, 1, true);
+        ssd1306_WriteString((int16_t)(24 + frame * 15), 24, "FG", 2, Font_5x8, true);
+        ssd1306_DrawLine(0, (int16_t)(60 - frame * 10), 127, (int16_t)(40 + frame * 5), 1, true);
+        ssd1306_SelectLayer(SSD1306_LAYER_MASK);
+        ssd1306_Clear();
+        ssd1306_FillRect((int16_t)(20 + frame * 15), 20, 30, 16, true);
+        if (frame == 0)
+            ssd1306_UpdateScreen();
+        else
+            ssd1306_UpdateDirty();
+    }
+}
+
+// A widget rendered once into a surface whose stride is wider than it, then blitted page aligned, unaligned and
+// clipped at the screen edges, and a line of text cached in a surface and blitted twice.
+static void scene_surface(void){
+    static uint8_t widget_buffer[5 * 40];
+    static uint8_t text_buffer[1 * 60];
+    ssd1306_surface_t widget, text;
+    ssd1306_InitSurface(&widget, widget_buffer, 32, 20, 40);
+    ssd1306_InitSurface(&text, text_buffer, 60, 8, 60);
+    ssd1306_SetSurface(&widget);
+    ssd1306_DrawRect(0, 0, 32, 20, 1, true);
+    ssd1306_FillCircle(9, 10, 6, true);
+    ssd1306_WriteString(18, 6, "OK", 2, Font_5x8, true);
+    ssd1306_SetSurface(&text);
+    ssd1306_WriteString(0, 0, "CACHED 42", 9, Font_5x8, true);
+    ssd1306_SetSurface(NULL);
+    ssd1306_FillRect(60, 0, 68, 64, true);
+    ssd1306_Blit(&widget, 0, 0, 32, 20, 0, 0);
+    ssd1306_Blit(&widget, 0, 0, 32, 20, 35, 13);
+    ssd1306_Blit(&widget, 0, 0, 32, 20, 110, 50);
+    ssd1306_Blit(&widget, 4, 3, 20, 12, 70, 5);
+    ssd1306_UpdateScreen();
+    ssd1306_Blit(&text, 0, 0, 60, 8, 2, 40);
+    ssd1306_Blit(&text, 0, 0, 60, 8, 64, 29);
+    ssd1306_UpdateDirty();
+}
+
+// Shifts inside a surface whose stride is wider than it: the left copy is blitted before the shifts, the right one
+// after. A ring scroll is refused while the surface is set and leaves the screen outline where it is.
+static void scene_surface_shift(void){
+    static uint8_t shift_buffer[3 * 64];
+    ssd1306_surface_t image;
+    ssd1306_InitSurface(&image, shift_buffer, 56, 24, 64);
+    ssd1306_DrawRect(0, 0, 128, 64, 1, true);
+    ssd1306_SetSurface(&image);
+    ssd1306_WriteString(2, 1, "SHIFT", 5, Font_5x8, true);
+    ssd1306_FillCircle(44, 6, 5, true);
+    ssd1306_DrawLine(0, 23, 55, 10, 1, true);
+    ssd1306_SetSurface(NULL);
+    ssd1306_Blit(&image, 0, 0, 56, 24, 4, 4);
+    ssd1306_SetSurface(&image);
+    ssd1306_ShiftHorizontal(0, 3, 40, 4, 7, false);
+    ssd1306_ShiftHorizontal(30, 0, 26, 12, -9, true);
+    ssd1306_ShiftVertical(0, 13, 56, 11, -5, false);
+    ssd1306_ShiftVertical(10, 0, 12, 24, 19, true);
+    ssd1306_ScrollFrame(8, false);
+    ssd1306_SetSurface(NULL);
+    ssd1306_Blit(&image, 0, 0, 56, 24, 66, 4);
+    ssd1306_Blit(&image, 0, 0, 56, 24, 66, 36);
+    ssd1306_UpdateScreen();
+}
+
+// Text laid out in boxes before drawing: wrapped left, centered and right aligned, ellipsis on the last line and on
+// a clipped single line. The boxes are outlined one pixel outside.
+static void scene_layout(void){
+    static const char text[] = "The quick brown fox jumps over the lazy dog";
+    static const struct { int16_t x, y, w, h; ssd1306_align_t align; uint8_t flags; } boxes[] = {
+        { 1, 1, 60, 26, SSD1306_ALIGN_LEFT, SSD1306_TEXT_WRAP },
+        { 66, 1, 61, 26, SSD1306_ALIGN_CENTER, SSD1306_TEXT_WRAP | SSD1306_TEXT_ELLIPSIS },
+        { 1, 31, 60, 17, SSD1306_ALIGN_RIGHT, SSD1306_TEXT_WRAP },
+        { 66, 31, 61, 8, SSD1306_ALIGN_LEFT, SSD1306_TEXT_ELLIPSIS },
+        { 66, 43, 61, 8, SSD1306_ALIGN_RIGHT, 0 },
+    };
+    ssd1306_text_layout_t layout;
+    for (uint8_t i = 0; i < sizeof(boxes) / sizeof(boxes[0]); i++) {
+        ssd1306_DrawRect((int16_t)(boxes[i].x - 1), (int16_t)(boxes[i].y - 1), (int16_t)(boxes[i].w + 2), (int16_t)(boxes[i].h + 2), 1, true);
+        ssd1306_Text_Layout(&layout, text, sizeof(text) - 1, Font_5x8, boxes[i].x, boxes[i].y, boxes[i].w, boxes[i].h,
+                            boxes[i].align, boxes[i].flags);
+        ssd1306_Text_Draw(&layout, true);
+    }
+    ssd1306_Text_Layout(&layout, "OK 42", 5, Font_5x8, 0, 54, 62, 8, SSD1306_ALIGN_CENTER, 0);
+    ssd1306_Text_Draw(&layout, true);
+    ssd1306_UpdateScreen();
+}
+
+// UTF-8 text in the European font: accented letters, the degree and euro signs, a Latin-1 byte through
+// ssd1306_WriteChar(), a string stopped at a glyph the font lacks, and a centered layout measured in characters rather than bytes.
+static void scene_utf8(void){
+    static const char line[] = "Gr\xC3\xB6\xC3\x9F" "e 20\xC2\xB0" "C 5\xE2\x82\xAC";
+    static const char label[] = "\xC3\x84pfel \xC3\xA0 la cr\xC3\xA8me, \xC3\xB1" "am \xC3\x9C" "ber alles";
+    ssd1306_WriteString(0, 0, line, sizeof(line) - 1, Font_5x8_European, true);
+    ssd1306_WriteChar(0, 10, (char)0xE7, Font_5x8_European, true);
+    ssd1306_WriteString(12, 10, "ok\xE2\x86\x92!", 6, Font_5x8_European, true);
+    ssd1306_DrawRect(19, 21, 90, 28, 1, true);
+    ssd1306_text_layout_t layout;
+    ssd1306_Text_Layout(&layout, label, sizeof(label) - 1, Font_5x8_European, 20, 22, 88, 26, SSD1306_ALIGN_CENTER,
+                        SSD1306_TEXT_WRAP | SSD1306_TEXT_ELLIPSIS);
+    ssd1306_Text_Draw(&layout, true);
+    ssd1306_UpdateScreen();
+}
+
+// Integer scaled text at 2x, 3x and 4x on page aligned and unaligned rows, the 4x line through the glyph cache,
+// and a bitmap enlarged 2x in both colors.
+static void scene_scaled(void){
+    static uint8_t cache[64];
+    static const uint8_t arrow[8] = { 0x18, 0x18, 0x18, 0x18, 0xFF, 0x7E, 0x3C, 0x18 };
+    ssd1306_Scale_WriteString(0, 0, "2x", 2, Font_5x8, 2, true);
+    ssd1306_Scale_WriteString(26, 3, "3x", 2, Font_5x8, 3, true);
+    ssd1306_Scale_SetCache(cache, sizeof(cache));
+    ssd1306_Scale_WriteString(0, 30, "21.5", 4, Font_5x8, 4, true);
+    ssd1306_Scale_SetCache(NULL, 0);
+    ssd1306_Scale_DrawBitmap(70, 5, arrow, 8, 8, 2, true);
+    ssd1306_FillRect(92, 0, 36, 26, true);
+    ssd1306_Scale_DrawBitmap(102, 5, arrow, 8, 8, 2, false);
+    ssd1306_UpdateScreen();
+}
+
+// Text fields updated in place and flushed through ssd1306_UpdateDirty(): a label whose value grows and shrinks, a
+// right aligned 2x readout, and an inverted field. Leftover cells of longer text must come out cleared.
+static void scene_field(void){
+    ssd1306_text_field_t rpm, speed, mode;
+    ssd1306_DrawRect(0, 0, 128, 64, 1, true);
+    ssd1306_FillRect(70, 44, 54, 16, true);
+    ssd1306_UpdateScreen();
+    ssd1306_Text_FieldInit(&rpm, 4, 4, 12, Font_5x8, 1, SSD1306_ALIGN_LEFT, true);
+    ssd1306_Text_FieldInit(&speed, 4, 20, 5, Font_5x8, 2, SSD1306_ALIGN_RIGHT, true);
+    ssd1306_Text_FieldInit(&mode, 74, 48, 7, Font_5x8, 1, SSD1306_ALIGN_CENTER, false);
+    static const char* const rpms[] = { "RPM: 1234", "RPM: 12345", "RPM: 987" };
+    static const char* const speeds[] = { "8", "120", "95" };
+    static const char* const modes[] = { "ECO", "SPORT", "AUTO" };
+    for (uint8_t i = 0; i < 3; i++) {
+        ssd1306_Text_FieldSet(&rpm, rpms[i], (uint16_t)strlen(rpms[i]));
+        ssd1306_Text_FieldSet(&speed, speeds[i], (uint16_t)strlen(speeds[i]));
+        ssd1306_Text_FieldSet(&mode, modes[i], (uint16_t)strlen(modes[i]));
+        ssd1306_UpdateDirty();
+    }
+}
+
+// Portrait drawing transposed at flush time, then a partial update through the rotated dirty spans and an area.
+static void rotate_scene(ssd1306_rotation_t rotation){
+    static uint8_t portrait_buffer[1024];
+    ssd1306_SetRotation(rotation, portrait_buffer);
+    ssd1306_DrawRect(0, 0, 64, 128, 1, true);
+    ssd1306_WriteString(4, 4, "PORTRAIT", 8, Font_5x8, true);
+    ssd1306_DrawCircle(32, 50, 20, 1, true);
+    ssd1306_DrawLine(2, 125, 61, 80, 1, true);
+    ssd1306_UpdateScreen();
+    ssd1306_WriteString(7, 100, "dirty", 5, Font_5x8, true);
+    ssd1306_UpdateDirty();
+    ssd1306_FillRect(40, 20, 13, 9, true);
+    ssd1306_UpdateArea(40, 20, 13, 9);
+}
+
+static void scene_rotate_90(void){
+    rotate_scene(SSD1306_ROTATE_90);
+}
+
+static void scene_rotate_270(void){
+    rotate_scene(SSD1306_ROTATE_270);
+}
+
+static const scene_t scenes[] = {
+    { "text", scene_text },
+    { "lines", scene_lines },
+    { "rects", scene_rects },
+    { "circles", scene_circles },
+    { "polys", scene_polys },
+    { "bitmap", scene_bitmap },
+    { "dirty", scene_dirty },
+    { "scroll", scene_scroll },
+    { "scroll_dma", scene_scroll_dma },
+    { "framing", scene_framing },
+    { "console", scene_console },
+    { "chart", scene_chart },
+    { "area", scene_area },
+    { "canvas_l", scene_canvas_left },
+    { "canvas_r", scene_canvas_right },
+    { "patterns", scene_patterns },
+    { "flood", scene_flood },
+    { "gauge", scene_gauge },
+    { "layers", scene_layers },
+    { "surface", scene_surface },
+    { "surface_shift", scene_surface_shift },
+    { "layout", scene_layout },
+    { "utf8", scene_utf8 },
+    { "scaled", scene_scaled },
+    { "field", scene_field },
+    { "rotate_90", scene_rotate_90 },
+    { "rotate_270", scene_rotate_270 },
+};
+
+// PBM and budget files.
+
+static bool read_pbm(const char* path, uint8_t* pixels){
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char magic[3] = { 0 };
+    int w = 0, h = 0;
+    bool ok = fscanf(f, "%2s %d %d", magic, &w, &h) == 3 && strcmp(magic, "P1") == 0 && w == WIDTH && h == HEIGHT;
+    for (int i = 0; ok && i < WIDTH * HEIGHT; i++) {
+        int c;
+        do c = fgetc(f); while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+        if (c != '0' && c != '1') ok = false;
+        else pixels[i] = (uint8_t)(c - '0');
+    }
+    fclose(f);
+    return ok;
+}
+
+static bool write_pbm(const char* path, const uint8_t* pixels){
+    FILE* f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "P1\n%d %d\n", WIDTH, HEIGHT);
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            fputc(pixels[y * WIDTH + x] ? '1' : '0', f);
+        }
+        fputc('\n', f);
+    }
+    return fclose(f) == 0;
+}
+
+static uint8_t read_budgets(const char* path, budget_t* budgets){
+    FILE* f = fopen(path, "r");
+    if (!f) return 0;
+    uint8_t count = 0;
+    char line[128];
+    while (count < MAX_SCENES && fgets(line, sizeof(line), f)) {
+        unsigned long ops, bytes;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%31s %lu %lu", budgets[count].name, &ops, &bytes) == 3) {
+            budgets[count].pixel_ops = (uint32_t)ops;
+            budgets[count].bus_bytes = (uint32_t)bytes;
+            count++;
+        }
+    }
+    fclose(f);
+    return count;
+}
+
+static const budget_t* find_budget(const budget_t* budgets, uint8_t count, const char* name){
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(budgets[i].name, name) == 0) return &budgets[i];
+    }
+    return NULL;
+}
+
+int main(int argc, char** argv){
+    bool update = false;
+    const char* dir = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) update = true;
+        else dir = argv[i];
+    }
+    if (!dir) {
+        fprintf(stderr, "usage: %s [--update] golden_dir\n", argv[0]);
+        return 2;
+    }
+
+    char path[512];
+    budget_t budgets[MAX_SCENES];
+    snprintf(path, sizeof(path), "%s/budgets.txt", dir);
+    uint8_t budget_count = update ? 0 : read_budgets(path, budgets);
+    budget_t measured[MAX_SCENES];
+
+    static uint8_t expected[WIDTH * HEIGHT];
+    static uint8_t actual[WIDTH * HEIGHT];
+    uint8_t scene_count = sizeof(scenes) / sizeof(scenes[0]);
+    int failures = 0;
+
+    for (uint8_t s = 0; s < scene_count; s++) {
+        const scene_t* scene = &scenes[s];
+        ssd1306_platform_init(0x3C);
+        ssd1306_Init();
+        ssd1306_ResetScroll();
+        ssd1306_Clear();
+        ssd1306_UpdateScreen();
+        ssd1306_ResetDrawStats();
+        ssd1306_host_reset_stats();
+
+        scene->draw();
+
+        ssd1306_draw_stats_t draw;
+        ssd1306_host_stats_t bus;
+        ssd1306_GetDrawStats(&draw);
+        ssd1306_host_get_stats(&bus);
+        ssd1306_host_render(actual);
+        snprintf(measured[s].name, sizeof(measured[s].name), "%s", scene->name);
+        measured[s].pixel_ops = draw.pixel_writes + draw.column_writes;
+        measured[s].bus_bytes = bus.command_bytes + bus.data_bytes;
+
+        snprintf(path, sizeof(path), "%s/%s.pbm", dir, scene->name);
+        if (update) {
+            if (!write_pbm(path, actual)) {
+                fprintf(stderr, "%s: cannot write\n", path);
+                return 1;
+            }
+            printf("%-10s updated, pixel ops %lu, bus bytes %lu\n", scene->name,
+                   (unsigned long)measured[s].pixel_ops, (unsigned long)measured[s].bus_bytes);
+            continue;
+        }
+
+        bool ok = true;
+        if (!read_pbm(path, expected)) {
+            printf("%-10s FAIL missing or invalid golden %s\n", scene->name, path);
+            ok = false;
+        } else {
+            uint32_t diff = 0;
+            int first_x = -1, first_y = -1;
+            for (int i = 0; i < WIDTH * HEIGHT; i++) {
+                if (expected[i] != actual[i]) {
+                    if (!diff) { first_x = i % WIDTH; first_y = i / WIDTH; }
+                    diff++;
+                }
+            }
+            if (diff) {
+                printf("%-10s FAIL %lu pixels differ, first at (%d, %d)\n", scene->name, (unsigned long)diff, first_x, first_y);
+                ok = false;
+            }
+        }
+        const budget_t* budget = find_budget(budgets, budget_count, scene->name);
+        if (!budget) {
+            printf("%-10s FAIL no budget\n", scene->name);
+            ok = false;
+        } else {
+            if (measured[s].pixel_ops > budget->pixel_ops) {
+                printf("%-10s FAIL pixel ops %lu over budget %lu\n", scene->name,
+                       (unsigned long)measured[s].pixel_ops, (unsigned long)budget->pixel_ops);
+                ok = false;
+            }
+            if (measured[s].bus_bytes > budget->bus_bytes) {
+                printf("%-10s FAIL bus bytes %lu over budget %lu\n", scene->name,
+                       (unsigned long)measured[s].bus_bytes, (unsigned long)budget->bus_bytes);
+                ok = false;
+            }
+        }
+        if (ok) {
+            printf("%-10s ok, pixel ops %lu, bus bytes %lu\n", scene->name,
+                   (unsigned long)measured[s].pixel_ops, (unsigned long)measured[s].bus_bytes);
+        } else {
+            // Keep what was rendered next to the test binary for inspection.
+            snprintf(path, sizeof(path), "%s.actual.pbm", scene->name);
+            write_pbm(path, actual);
+            failures++;
+        }
+    }
+
+    if (update) {
+        snprintf(path, sizeof(path), "%s/budgets.txt", dir);
+        FILE* f = fopen(path, "w");
+        if (!f) {
+            fprintf(stderr, "%s: cannot write\n", path);
+            return 1;
+        }
+        fprintf(f, "# scene pixel_ops bus_bytes\n");
+        for (uint8_t s = 0; s < scene_count; s++) {
+            fprintf(f, "%s %lu %lu\n", measured[s].name, (unsigned long)measured[s].pixel_ops, (unsigned long)measured[s].bus_bytes);
+        }
+        fclose(f);
+        return 0;
+    }
+    printf("%d of %u scenes failed\n", failures, scene_count);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+/*
+*   ssd1306_video_encode.c
+*   Created on 10/18/2026
+*   Author Ikshwak Jinesh
+*
+*   Host tool that encodes a sequence of 128x64 PBM images into a stream for ssd1306_video.c.
+*   Usage: ssd1306_video_encode [-f fps] [-k keyframe_interval] [-i] -o out.s1vd frame0.pbm frame1.pbm ...
+*   Set PBM pixels (black) are encoded as lit pixels, -i inverts that.
+*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_video.h"
+
+#define FRAME_W 128
+#define FRAME_H 64
+
+/**
+ * @brief  Skips whitespace and comments of a PBM header.
+ */
+static int pbm_skip(FILE* f){
+    int c = fgetc(f);
+    while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(f);
+        }
+        c = fgetc(f);
+    }
+    return c;
+}
+
+static bool pbm_read_int(FILE* f, int* value){
+    int c = pbm_skip(f);
+    if (c < '0' || c > '9') return false;
+    *value = 0;
+    while (c >= '0' && c <= '9') {
+        *value = *value * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return true;
+}
+
+/**
+ * @brief  Loads a P1 or P4 PBM into a page ordered frame.
+ */
+static bool pbm_load(const char* path, bool invert, uint8_t* frame){
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    char magic[2];
+    int w, h;
+    bool ok = fread(magic, 1, 2, f) == 2 && magic[0] == 'P' && (magic[1] == '1' || magic[1] == '4') &&
+              pbm_read_int(f, &w) && pbm_read_int(f, &h);
+    if (!ok || w != FRAME_W || h != FRAME_H) {
+        fprintf(stderr, "%s: expected a %dx%d P1 or P4 PBM\n", path, FRAME_W, FRAME_H);
+        fclose(f);
+        return false;
+    }
+    memset(frame, 0, SSD1306_VIDEO_FRAME_SIZE);
+    int byte = 0;
+    for (int y = 0; y < h && ok; y++) {
+        for (int x = 0; x < w; x++) {
+            int bit;
+            if (magic[1] == '4') {
+                if ((x & 7) == 0) {
+                    byte = fgetc(f);
+                    if (byte == EOF) { ok = false; break; }
+                }
+                bit = (byte >> (7 - (x & 7))) & 1;
+            } else {
+                int c = pbm_skip(f);
+                if (c != '0' && c != '1') { ok = false; break; }
+                bit = c - '0';
+            }
+            if (bit ^ invert) {
+                frame[x + (y / 8) * FRAME_W] |= (uint8_t)(1 << (y & 7));
+            }
+        }
+    }
+    fclose(f);
+    if (!ok) fprintf(stderr, "%s: truncated\n", path);
+    return ok;
+}
+
+int main(int argc, char** argv){
+    int fps = 30;
+    int key_interval = 60;
+    bool invert = false;
+    const char* out_path = NULL;
+    int first = 1;
+    while (first < argc && argv[first][0] == '-') {
+        if (!strcmp(argv[first], "-f") && first + 1 < argc) fps = atoi(argv[++first]);
+        else if (!strcmp(argv[first], "-k") && first + 1 < argc) key_interval = atoi(argv[++first]);
+        else if (!strcmp(argv[first], "-o") && first + 1 < argc) out_path = argv[++first];
+        else if (!strcmp(argv[first], "-i")) invert = true;
+        else break;
+        first++;
+    }
+    if (!out_path || first >= argc || fps < 1 || fps > 255 || key_interval < 1) {
+        fprintf(stderr, "usage: %s [-f fps] [-k keyframe_interval] [-i] -o out.s1vd frame0.pbm ...\n", argv[0]);
+        return 2;
+    }
+    FILE* out = fopen(out_path, "wb");
+    if (!out) {
+        fprintf(stderr, "%s: cannot create\n", out_path);
+        return 1;
+    }
+
+    uint32_t frame_count = (uint32_t)(argc - first);
+    uint8_t header[SSD1306_VIDEO_HEADER_SIZE] = { 'S', '1', 'V', 'D', SSD1306_VIDEO_VERSION, FRAME_W, FRAME_H, (uint8_t)fps,
+                                                  (uint8_t)frame_count, (uint8_t)(frame_count >> 8),
+                                                  (uint8_t)(frame_count >> 16), (uint8_t)(frame_count >> 24), 0, 0, 0, 0 };
+    fwrite(header, 1, sizeof(header), out);
+
+    static uint8_t prev[SSD1306_VIDEO_FRAME_SIZE], cur[SSD1306_VIDEO_FRAME_SIZE], delta[SSD1306_VIDEO_FRAME_SIZE];
+    uint32_t keyframes = 0;
+    uint64_t total = 0;
+    for (uint32_t f = 0; f < frame_count; f++) {
+        if (!pbm_load(argv[first + f], invert, cur)) {
+            fclose(out);
+            return 1;
+        }
+        uint32_t len = (f % (uint32_t)key_interval) == 0 ? SSD1306_VIDEO_FRAME_SIZE : ssd1306_Video_EncodeDelta(prev, cur, delta);
+        uint8_t type = SSD1306_VIDEO_DELTA;
+        const uint8_t* payload = delta;
+        if (len >= SSD1306_VIDEO_FRAME_SIZE) {
+            type = SSD1306_VIDEO_KEYFRAME;
+            payload = cur;
+            len = SSD1306_VIDEO_FRAME_SIZE;
+            keyframes++;
+        }
+        uint8_t frame_header[3] = { type, (uint8_t)len, (uint8_t)(len >> 8) };
+        fwrite(frame_header, 1, 3, out);
+        fwrite(payload, 1, len, out);
+        total += 3 + len;
+        memcpy(prev, cur, sizeof(prev));
+    }
+    fclose(out);
+    printf("{\"frames\": %u, \"keyframes\": %u, \"stream_bytes\": %llu, \"avg_frame_bytes\": %.1f}\n",
+           frame_count, keyframes, (unsigned long long)(total + SSD1306_VIDEO_HEADER_SIZE), (double)total / frame_count);
+    return 0;
+}